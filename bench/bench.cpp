@@ -0,0 +1,162 @@
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+struct Benchmark
+{
+  const char *name;
+  BenchFunction function;
+};
+
+// Filled by static constructors, so it must not depend on initialization order
+static std::vector<Benchmark> &benchmarks()
+{
+  static std::vector<Benchmark> list;
+  return list;
+}
+
+BenchRegistration::BenchRegistration(const char *name, BenchFunction function)
+{
+  benchmarks().push_back({name, function});
+}
+
+// Allocations of the benchmark thread only, the firmware's tasks run on their own threads
+static thread_local bool countingAllocations = false;
+static thread_local uint64_t allocations = 0;
+static thread_local uint64_t allocatedBytes = 0;
+
+void *operator new(size_t size)
+{
+  if (countingAllocations)
+  {
+    allocations++;
+    allocatedBytes += size;
+  }
+  void *memory = malloc(size != 0 ? size : 1);
+  if (memory == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void *memory, size_t size) noexcept
+{
+  free(memory);
+}
+
+void operator delete[](void *memory, size_t size) noexcept
+{
+  free(memory);
+}
+
+static int64_t nowNanos()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void BenchState::resetTimer()
+{
+  startNanos = nowNanos();
+  startAllocations = allocations;
+  startBytes = allocatedBytes;
+  stopNanos = 0;
+}
+
+void BenchState::stopTimer()
+{
+  stopNanos = nowNanos();
+  countingAllocations = false;
+}
+
+struct BenchResult
+{
+  double nanosPerOp;
+  double allocationsPerOp;
+  double bytesPerOp;
+};
+
+static BenchResult runOnce(BenchFunction function, uint64_t iterations)
+{
+  BenchState state;
+  state.iterations = iterations;
+  countingAllocations = true;
+  state.resetTimer();
+  function(state);
+  int64_t elapsed = (state.stopNanos != 0 ? state.stopNanos : nowNanos()) - state.startNanos;
+  countingAllocations = false;
+  return {(double)elapsed / iterations, (double)(allocations - state.startAllocations) / iterations,
+          (double)(allocatedBytes - state.startBytes) / iterations};
+}
+
+static long environmentNumber(const char *name, long defaultValue)
+{
+  const char *value = getenv(name);
+  return value != nullptr && atol(value) > 0 ? atol(value) : defaultValue;
+}
+
+int main(int argc, char **argv)
+{
+  const char *filter = argc > 1 ? argv[1] : "";
+  int64_t minNanos = environmentNumber("BENCH_MIN_TIME_MS", 200) * 1000000;
+  long repeats = environmentNumber("BENCH_REPEATS", 5);
+
+  benchSetup();
+  for (const Benchmark &benchmark : benchmarks())
+  {
+    if (strstr(benchmark.name, filter) == nullptr)
+    {
+      continue;
+    }
+    // Grow the iteration count until one run is long enough to time
+    uint64_t iterations = 1;
+    BenchResult result = runOnce(benchmark.function, iterations);
+    while (result.nanosPerOp * iterations < minNanos && iterations < (1ULL << 40))
+    {
+      double target = minNanos / std::max(result.nanosPerOp, 0.1);
+      iterations = std::max<uint64_t>(iterations * 2, std::min<uint64_t>((uint64_t)(target * 1.2), iterations * 100));
+      result = runOnce(benchmark.function, iterations);
+    }
+
+    std::vector<BenchResult> results;
+    for (long i = 0; i < repeats; i++)
+    {
+      results.push_back(runOnce(benchmark.function, iterations));
+    }
+    std::sort(results.begin(), results.end(),
+              [](const BenchResult &a, const BenchResult &b) { return a.nanosPerOp < b.nanosPerOp; });
+    const BenchResult &median = results[results.size() / 2];
+    printf("{\"benchmark\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.2f,\"ns_per_op_min\":%.2f,"
+           "\"allocs_per_op\":%.3f,\"bytes_per_op\":%.1f}\n",
+           benchmark.name, (unsigned long long)iterations, median.nanosPerOp, results[0].nanosPerOp,
+           median.allocationsPerOp, median.bytesPerOp);
+    fflush(stdout);
+    fprintf(stderr, "%-28s %12.1f ns/op %8.2f allocs/op\n", benchmark.name, median.nanosPerOp,
+            median.allocationsPerOp);
+  }
+  return 0;
+}
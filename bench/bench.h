@@ -0,0 +1,53 @@
+/*
+ *  bench.h
+ *
+ *  Microbenchmarks of the firmware's hot paths, run on the host against lib/NativeShims:
+ *
+ *    pio run -e bench -t exec > bench.jsonl
+ *    python3 bench/compare.py before.jsonl after.jsonl
+ *
+ *  Each benchmark is a function running its body state.iterations times. The runner grows the
+ *  iteration count until a run takes BENCH_MIN_TIME_MS (default 200), repeats it BENCH_REPEATS
+ *  times (default 5) and prints one JSON line per benchmark with the median ns/op and the heap
+ *  allocations per op counted on the benchmark thread. An argument limits the run to benchmarks
+ *  whose name contains it.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct BenchState
+{
+  uint64_t iterations;
+  int64_t startNanos;
+  uint64_t startAllocations;
+  uint64_t startBytes;
+  int64_t stopNanos;
+
+  // Call after setup and before cleanup that should not be measured
+  void resetTimer();
+  void stopTimer();
+};
+
+typedef void (*BenchFunction)(BenchState &state);
+
+struct BenchRegistration
+{
+  BenchRegistration(const char *name, BenchFunction function);
+};
+
+#define BENCH(name, function) static BenchRegistration function##Registration(name, function)
+
+// Runs once before the first benchmark, defined next to the benchmarks
+void benchSetup();
+
+// Keeps the compiler from optimizing a result away
+template <typename T>
+inline void benchKeep(const T &value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif // BENCH_H
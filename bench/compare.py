@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Compares two benchmark runs (JSON lines from "pio run -e bench -t exec").
+
+    python3 bench/compare.py before.jsonl after.jsonl
+
+Prints ns/op and allocs/op of both runs and the change, and exits with 1 if a benchmark
+got slower than --threshold percent (default 10), so it can gate a CI job.
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    results = {}
+    with open(path) as lines:
+        for line in lines:
+            line = line.strip()
+            if line.startswith("{"):
+                result = json.loads(line)
+                results[result["benchmark"]] = result
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("before")
+    parser.add_argument("after")
+    parser.add_argument("--threshold", type=float, default=10.0, help="slowdown in percent that fails")
+    args = parser.parse_args()
+
+    before = load(args.before)
+    after = load(args.after)
+    slower = []
+    print(f"{'benchmark':28} {'before ns/op':>14} {'after ns/op':>14} {'change':>8} {'allocs/op':>16}")
+    for name in list(before) + [name for name in after if name not in before]:
+        old = before.get(name)
+        new = after.get(name)
+        if old is None or new is None:
+            value = old or new
+            side = "before" if new is None else "after"
+            print(f"{name:28} only in {side} run: {value['ns_per_op']:.1f} ns/op")
+            continue
+        change = (new["ns_per_op"] - old["ns_per_op"]) / old["ns_per_op"] * 100 if old["ns_per_op"] else 0.0
+        allocs = f"{old['allocs_per_op']:.2f} -> {new['allocs_per_op']:.2f}"
+        print(f"{name:28} {old['ns_per_op']:14.1f} {new['ns_per_op']:14.1f} {change:+7.1f}% {allocs:>16}")
+        if change > args.threshold:
+            slower.append(name)
+    if slower:
+        print(f"slower by more than {args.threshold:g}%: {', '.join(slower)}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,325 @@
+#include "bench.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <thread>
+
+#include "batch.h"
+#include "codes.h"
+#include "httpParser.h"
+#include "irTask.h"
+#include "logger.h"
+#include "macro.h"
+#include "metrics.h"
+#include "page.h"
+#include "scheduler.h"
+
+// From src/main.cpp, linked in unchanged
+size_t dispatch(WiFiClient &client, const HttpRequest &request);
+void handlePage(WiFiClient &client, const HttpRequest &request);
+
+// What a phone browser sends for the page, split into the 64 byte reads of loop()
+static const char browserRequest[] =
+    "GET /setChannel?setChannelInput=105 HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "Upgrade-Insecure-Requests: 1\r\n"
+    "User-Agent: Mozilla/5.0 (Linux; Android 14; Pixel 7) AppleWebKit/537.36 (KHTML, like Gecko) "
+    "Chrome/124.0.0.0 Mobile Safari/537.36\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-US,en;q=0.9\r\n"
+    "\r\n";
+
+// Responses go into a socket pair drained by a thread, so every print() costs a send() like on the board
+static WiFiClient sink;
+
+static void drain(int fd)
+{
+  char buffer[4096];
+  while (read(fd, buffer, sizeof(buffer)) > 0)
+  {
+  }
+}
+
+void benchSetup()
+{
+  nativeSerialOutput(NULL);
+  setenv("NATIVE_NVS_DIR", "/tmp/irannoy-bench-nvs", 0);
+  setenv("NATIVE_IR_REALTIME", "0", 0);
+  logBegin();
+  irTaskStart();
+  schedulerStart();
+
+  int fds[2];
+  socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+  sink = WiFiClient(fds[0]);
+  std::thread(drain, fds[1]).detach();
+}
+
+static void parseRequest(HttpRequest &request, const char *text, size_t length)
+{
+  httpRequestReset(request);
+  for (size_t offset = 0; offset < length; offset += 64)
+  {
+    size_t chunk = length - offset < 64 ? length - offset : 64;
+    if (httpParse(request, text + offset, chunk) != HTTP_PARSE_MORE)
+    {
+      break;
+    }
+  }
+}
+
+// What the firmware did at run time before the table was built by the compiler
+static void benchProntoParse(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    benchKeep(necFromPronto(keyPronto[i % KEY_COUNT]));
+  }
+}
+BENCH("pronto/parse", benchProntoParse);
+
+static void benchProntoTable(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    benchKeep(keyCodes[i % KEY_COUNT]);
+  }
+}
+BENCH("pronto/table", benchProntoTable);
+
+// Resolving the names of /key/<name>, macros and batches, spread over the whole table
+static void benchKeyLookup(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    const char *name = keyNames[(i * 7) % KEY_COUNT];
+    benchKeep(keyFromName(name, strlen(name)));
+  }
+}
+BENCH("key/lookup", benchKeyLookup);
+
+static void benchKeyLookupMiss(BenchState &state)
+{
+  static const char *unknown[] = {"Volume", "ChannelUpp", "power", "10"};
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    const char *name = unknown[i % 4];
+    benchKeep(keyFromName(name, strlen(name)));
+  }
+}
+BENCH("key/lookup_miss", benchKeyLookupMiss);
+
+static void benchHttpParse(BenchState &state)
+{
+  HttpRequest request;
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    parseRequest(request, browserRequest, sizeof(browserRequest) - 1);
+    benchKeep(request.path);
+  }
+}
+BENCH("http/parse", benchHttpParse);
+
+// Parse and route a request to a JSON handler with a small answer
+static void benchHttpRoute(BenchState &state)
+{
+  static const char statusRequest[] = "GET /irStatus HTTP/1.1\r\nHost: 192.168.4.1\r\n\r\n";
+  HttpRequest request;
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    parseRequest(request, statusRequest, sizeof(statusRequest) - 1);
+    dispatch(sink, request);
+  }
+}
+BENCH("http/route", benchHttpRoute);
+
+static void benchQueryLong(BenchState &state)
+{
+  HttpRequest request;
+  parseRequest(request, browserRequest, sizeof(browserRequest) - 1);
+  state.resetTimer();
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    long value = 0;
+    benchKeep(httpQueryLong(request, "setChannelInput", &value));
+    benchKeep(value);
+  }
+}
+BENCH("query/long", benchQueryLong);
+
+static void benchQueryText(BenchState &state)
+{
+  static const char defineRequest[] =
+      "GET /macro/define?name=vol3&code=repeat%3A3%2CVolumeUp%2Cwait%3A200%2Cend HTTP/1.1\r\n\r\n";
+  HttpRequest request;
+  parseRequest(request, defineRequest, sizeof(defineRequest) - 1);
+  state.resetTimer();
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    char source[HTTP_MAX_REQUEST_LINE];
+    benchKeep(httpQueryText(request, "code", source, sizeof(source)));
+    benchKeep(source[0]);
+  }
+}
+BENCH("query/text", benchQueryText);
+
+// First visit of a browser, the gzipped page from flash
+static void benchPageRender(BenchState &state)
+{
+  HttpRequest request;
+  parseRequest(request, browserRequest, sizeof(browserRequest) - 1);
+  state.resetTimer();
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    handlePage(sink, request);
+  }
+}
+BENCH("page/render", benchPageRender);
+
+// Every later visit, the browser revalidates its copy
+static void benchPageNotModified(BenchState &state)
+{
+  static const char revalidateRequest[] = "GET / HTTP/1.1\r\nHost: 192.168.4.1\r\nIf-None-Match: " PAGE_ETAG
+                                          "\r\nAccept-Encoding: gzip, deflate\r\n\r\n";
+  HttpRequest request;
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    parseRequest(request, revalidateRequest, sizeof(revalidateRequest) - 1);
+    dispatch(sink, request);
+  }
+}
+BENCH("page/not_modified", benchPageNotModified);
+
+static void benchPageState(BenchState &state)
+{
+  static const char stateRequest[] = "GET /state HTTP/1.1\r\nHost: 192.168.4.1\r\n\r\n";
+  HttpRequest request;
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    parseRequest(request, stateRequest, sizeof(stateRequest) - 1);
+    dispatch(sink, request);
+  }
+}
+BENCH("page/state", benchPageState);
+
+static void benchMacroCompile(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    Macro macro;
+    const char *error;
+    benchKeep(macroCompile(MACRO_CHANNEL_DEFAULT, macro, &error));
+    benchKeep(macro.length);
+  }
+}
+BENCH("macro/compile", benchMacroCompile);
+
+// Checking a scripted sequence up front, before anything of it is queued
+static void benchBatchParse(BenchState &state)
+{
+  static const char steps[] = "PowerOn, wait:2000, channel:105, VolumeUp, VolumeUp, VolumeUp, fave:3";
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    IrBatch batch;
+    size_t failedStep;
+    const char *error;
+    benchKeep(batchParse(steps, batch, &failedStep, &error));
+    benchKeep(batch.length);
+  }
+}
+BENCH("batch/parse", benchBatchParse);
+
+// Heap insert and removal with the schedule nearly full, the work of one add or remove request
+static void benchSchedulerAddRemove(BenchState &state)
+{
+  uint16_t ids[SCHEDULER_MAX_JOBS - 1];
+  for (size_t i = 0; i < SCHEDULER_MAX_JOBS - 1; i++)
+  {
+    ids[i] = schedulerAdd({IR_COMMAND_FAVORITE, (uint16_t)(i % 10), 3600000, 0}, 3600000 + i * 1000);
+  }
+  state.resetTimer();
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    uint16_t id = schedulerAdd({IR_COMMAND_KEY, KEY_MUTE, 3600000, 0}, (1 + i % 7) * 600000);
+    schedulerRemove(id);
+  }
+  state.stopTimer();
+  for (uint16_t id : ids)
+  {
+    schedulerRemove(id);
+  }
+}
+BENCH("scheduler/add_remove", benchSchedulerAddRemove);
+
+static void benchSchedulerList(BenchState &state)
+{
+  uint16_t ids[SCHEDULER_MAX_JOBS];
+  for (size_t i = 0; i < SCHEDULER_MAX_JOBS; i++)
+  {
+    ids[i] = schedulerAdd({IR_COMMAND_FAVORITE, (uint16_t)(i % 10), 3600000, 0}, 3600000 + i * 1000);
+  }
+  state.resetTimer();
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    ScheduledJobInfo jobs[SCHEDULER_MAX_JOBS];
+    benchKeep(schedulerList(jobs, SCHEDULER_MAX_JOBS));
+  }
+  state.stopTimer();
+  for (uint16_t id : ids)
+  {
+    schedulerRemove(id);
+  }
+}
+BENCH("scheduler/list", benchSchedulerList);
+
+// A job falling due until its command is in the IR queue: wake-up, heap pop and re-push, enqueue
+static void benchSchedulerFire(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    uint32_t queued = irLastQueued();
+    uint16_t id = schedulerAdd({IR_COMMAND_KEY, KEY_MUTE, 3600000, 0}, 0);
+    while (irLastQueued() == queued)
+    {
+    }
+    schedulerRemove(id);
+  }
+}
+BENCH("scheduler/fire", benchSchedulerFire);
+
+// What a log line on the request or IR path costs its caller, formatting and the UART are the
+// drain task's. Records the drain cannot keep up with are dropped, which costs the same.
+static void benchLogWrite(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    logWrite(LOG_LEVEL_INFO, "Sending job %u", (uint32_t)i);
+  }
+}
+BENCH("log/write", benchLogWrite);
+
+static void benchLogWriteText(BenchState &state)
+{
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    logWriteText(LOG_LEVEL_INFO, "%s", "GET /setChannel");
+  }
+}
+BENCH("log/write_text", benchLogWriteText);
+
+// What instrumenting a request or a send adds to it
+static void benchMetricsObserve(BenchState &state)
+{
+  static LatencyHistogram histogram;
+  for (uint64_t i = 0; i < state.iterations; i++)
+  {
+    histogram.observe((uint32_t)(i * 7919) % 3000000);
+  }
+}
+BENCH("metrics/observe", benchMetricsObserve);
@@ -0,0 +1,260 @@
+#include "Arduino.h"
+
+#include <stdarg.h>
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static FILE *serialOutput = stdout;
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static std::mutex randomMutex;
+static std::mt19937 randomGenerator;
+
+void nativeSerialOutput(FILE *file)
+{
+  serialOutput = file;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  if (serialOutput != nullptr)
+  {
+    fwrite(buffer, 1, size, serialOutput);
+  }
+  return size;
+}
+
+void HardwareSerial::flush()
+{
+  if (serialOutput != nullptr)
+  {
+    fflush(serialOutput);
+  }
+}
+
+int64_t esp_timer_get_time()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long millis()
+{
+  return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros()
+{
+  return (unsigned long)esp_timer_get_time();
+}
+
+void delay(uint32_t ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield()
+{
+  std::this_thread::yield();
+}
+
+long random(long howbig)
+{
+  if (howbig <= 0)
+  {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(randomMutex);
+  return (long)(randomGenerator() % (unsigned long)howbig);
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig)
+  {
+    return howsmall;
+  }
+  return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed)
+{
+  std::lock_guard<std::mutex> lock(randomMutex);
+  randomGenerator.seed(seed);
+}
+
+// There are no pins on the host, outputs are remembered so a test can read them back
+static uint8_t pinLevels[64];
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  if (pin < sizeof(pinLevels))
+  {
+    pinLevels[pin] = val;
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < sizeof(pinLevels) ? pinLevels[pin] : LOW;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    if (write(*buffer++) == 0)
+    {
+      break;
+    }
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char stackBuffer[64];
+  char *buffer = stackBuffer;
+  va_list arguments;
+  va_start(arguments, format);
+  int length = vsnprintf(stackBuffer, sizeof(stackBuffer), format, arguments);
+  va_end(arguments);
+  if (length < 0)
+  {
+    return 0;
+  }
+  if ((size_t)length >= sizeof(stackBuffer))
+  {
+    buffer = new char[length + 1];
+    va_start(arguments, format);
+    vsnprintf(buffer, length + 1, format, arguments);
+    va_end(arguments);
+  }
+  size_t n = write((const uint8_t *)buffer, length);
+  if (buffer != stackBuffer)
+  {
+    delete[] buffer;
+  }
+  return n;
+}
+
+size_t Print::printNumber(unsigned long long number, int base)
+{
+  char buffer[8 * sizeof(number) + 1];
+  char *text = &buffer[sizeof(buffer) - 1];
+  *text = '\0';
+  if (base < 2)
+  {
+    base = 10;
+  }
+  do
+  {
+    int digit = number % base;
+    number /= base;
+    *--text = digit < 10 ? '0' + digit : 'A' + digit - 10;
+  } while (number != 0);
+  return write(text);
+}
+
+size_t Print::print(long number, int base)
+{
+  return print((long long)number, base);
+}
+
+size_t Print::print(unsigned long number, int base)
+{
+  return printNumber(number, base);
+}
+
+size_t Print::print(long long number, int base)
+{
+  if (base == 10 && number < 0)
+  {
+    return print('-') + printNumber(-(unsigned long long)number, 10);
+  }
+  return printNumber((unsigned long long)number, base);
+}
+
+size_t Print::print(unsigned long long number, int base)
+{
+  return printNumber(number, base);
+}
+
+size_t Print::print(double number, int digits)
+{
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", digits, number);
+  return write(buffer);
+}
+
+String::String(long number, unsigned char base)
+{
+  if (base == 10)
+  {
+    value = std::to_string(number);
+  }
+  else
+  {
+    *this = String((unsigned long)number, base);
+  }
+}
+
+String::String(unsigned long number, unsigned char base)
+{
+  do
+  {
+    int digit = number % base;
+    number /= base;
+    value.insert(value.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+  } while (number != 0);
+}
+
+String::String(double number, unsigned char decimals)
+{
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, number);
+  value = buffer;
+}
+
+void String::trim()
+{
+  size_t begin = value.find_first_not_of(" \t\r\n");
+  size_t end = value.find_last_not_of(" \t\r\n");
+  value = begin == std::string::npos ? std::string() : value.substr(begin, end - begin + 1);
+}
+
+void String::toLowerCase()
+{
+  for (char &c : value)
+  {
+    c = tolower((unsigned char)c);
+  }
+}
+
+void String::toUpperCase()
+{
+  for (char &c : value)
+  {
+    c = toupper((unsigned char)c);
+  }
+}
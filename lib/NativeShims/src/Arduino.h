@@ -0,0 +1,91 @@
+/*
+ *  Arduino.h
+ *
+ *  Arduino core for the native environment (platformio run -e native). Provides what the firmware
+ *  uses from the ESP32 core on a POSIX host: Serial on stdout, millis() and delay() on the
+ *  monotonic clock, the FreeRTOS API on threads, and a main() that calls setup() and loop().
+ *  Together with the WiFi, IRremote and Preferences stand-ins next to it the control server,
+ *  scheduler and IR encoding run unchanged on a workstation.
+ */
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#define ARDUINO_ARCH_NATIVE
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Print.h"
+#include "WString.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define F(string_literal) (string_literal)
+#define PROGMEM
+#define PSTR(string_literal) (string_literal)
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long baud) {}
+  void end() {}
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  void flush() override;
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// The host has no fixed heap, it reports the size of the ESP32's internal heap as free
+class EspClass
+{
+public:
+  uint32_t getHeapSize() { return 327680; }
+  uint32_t getFreeHeap() { return getHeapSize(); }
+  uint32_t getMinFreeHeap() { return getHeapSize(); }
+  uint32_t getMaxAllocHeap() { return getHeapSize(); }
+  void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+// Host only: where Serial writes go, stdout by default, NULL discards them (benchmarks)
+void nativeSerialOutput(FILE *file);
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+void setup();
+void loop();
+
+#endif // NATIVE_ARDUINO_H
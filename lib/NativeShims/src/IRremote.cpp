@@ -0,0 +1,152 @@
+#include "IRremote.hpp"
+
+#include <deque>
+#include <mutex>
+
+// Same timing as ir_NEC.hpp, in microseconds
+#define NATIVE_NEC_UNIT 560
+#define NATIVE_NEC_HEADER_MARK (16 * NATIVE_NEC_UNIT)
+#define NATIVE_NEC_HEADER_SPACE (8 * NATIVE_NEC_UNIT)
+#define NATIVE_NEC_ONE_SPACE (3 * NATIVE_NEC_UNIT)
+#define NATIVE_NEC_REPEAT_HEADER_SPACE (4 * NATIVE_NEC_UNIT)
+#define NATIVE_NEC_REPEAT_PERIOD 110000
+#define NATIVE_RECORDER_SIZE 65536
+
+IRsend IrSender;
+
+static std::mutex recorderMutex;
+static std::deque<int32_t> recorded;
+static uint32_t recordedFrames = 0;
+
+static void record(int32_t duration)
+{
+  std::lock_guard<std::mutex> lock(recorderMutex);
+  // Marks and spaces following each other are one longer pulse, as a receiver would see them
+  if (!recorded.empty() && (recorded.back() > 0) == (duration > 0))
+  {
+    recorded.back() += duration;
+    return;
+  }
+  if (recorded.size() >= NATIVE_RECORDER_SIZE)
+  {
+    recorded.pop_front();
+  }
+  recorded.push_back(duration);
+}
+
+static bool realtime()
+{
+  static const bool enabled = getenv("NATIVE_IR_REALTIME") == nullptr || atoi(getenv("NATIVE_IR_REALTIME")) != 0;
+  return enabled;
+}
+
+void IRsend::begin()
+{
+}
+
+void IRsend::begin(uint_fast8_t aSendPin, bool aEnableLEDFeedback, uint_fast8_t aFeedbackLEDPin)
+{
+  sendPin = aSendPin;
+}
+
+void IRsend::mark(unsigned int aMarkMicros)
+{
+  record((int32_t)aMarkMicros);
+}
+
+void IRsend::space(unsigned int aSpaceMicros)
+{
+  record(-(int32_t)aSpaceMicros);
+}
+
+void IRsend::sendNECRaw(uint32_t aRawData, int_fast8_t aNumberOfRepeats)
+{
+  Serial.printf("[native] IR NEC 0x%08x, %d repeats\n", (unsigned)aRawData, (int)aNumberOfRepeats);
+  int64_t start = esp_timer_get_time();
+  uint32_t frameMicros = NATIVE_NEC_HEADER_MARK + NATIVE_NEC_HEADER_SPACE + NATIVE_NEC_UNIT;
+  mark(NATIVE_NEC_HEADER_MARK);
+  space(NATIVE_NEC_HEADER_SPACE);
+  for (int i = 0; i < 32; i++)
+  {
+    uint32_t bitSpace = (aRawData >> i) & 1 ? NATIVE_NEC_ONE_SPACE : NATIVE_NEC_UNIT;
+    mark(NATIVE_NEC_UNIT);
+    space(bitSpace);
+    frameMicros += NATIVE_NEC_UNIT + bitSpace;
+  }
+  mark(NATIVE_NEC_UNIT);
+  {
+    std::lock_guard<std::mutex> lock(recorderMutex);
+    recordedFrames++;
+  }
+  for (int_fast8_t i = 0; i < aNumberOfRepeats; i++)
+  {
+    // Repeats start NEC_REPEAT_PERIOD after the start of the previous frame
+    space(NATIVE_NEC_REPEAT_PERIOD - frameMicros);
+    sendNECSpecialRepeat();
+    frameMicros = NATIVE_NEC_HEADER_MARK + NATIVE_NEC_REPEAT_HEADER_SPACE + NATIVE_NEC_UNIT;
+  }
+  uint32_t airMicros = aNumberOfRepeats * NATIVE_NEC_REPEAT_PERIOD + frameMicros;
+  if (realtime())
+  {
+    int64_t left = airMicros - (esp_timer_get_time() - start);
+    if (left > 0)
+    {
+      delayMicroseconds(left);
+    }
+  }
+}
+
+void IRsend::sendNEC(uint16_t aAddress, uint16_t aCommand, int_fast8_t aNumberOfRepeats)
+{
+  uint32_t raw = aAddress < 0x100 ? (aAddress | (uint32_t)(uint8_t)~aAddress << 8) : aAddress;
+  raw |= aCommand < 0x100 ? ((uint32_t)aCommand | (uint32_t)(uint8_t)~aCommand << 8) << 16 : (uint32_t)aCommand << 16;
+  sendNECRaw(raw, aNumberOfRepeats);
+}
+
+void IRsend::sendNECSpecialRepeat()
+{
+  mark(NATIVE_NEC_HEADER_MARK);
+  space(NATIVE_NEC_REPEAT_HEADER_SPACE);
+  mark(NATIVE_NEC_UNIT);
+  std::lock_guard<std::mutex> lock(recorderMutex);
+  recordedFrames++;
+}
+
+void IRsend::sendNECRepeat()
+{
+  int64_t start = esp_timer_get_time();
+  sendNECSpecialRepeat();
+  if (realtime())
+  {
+    int64_t left = NATIVE_NEC_HEADER_MARK + NATIVE_NEC_REPEAT_HEADER_SPACE + NATIVE_NEC_UNIT -
+                   (esp_timer_get_time() - start);
+    if (left > 0)
+    {
+      delayMicroseconds(left);
+    }
+  }
+}
+
+size_t irRecordedDurations(int32_t *durations, size_t maxDurations)
+{
+  std::lock_guard<std::mutex> lock(recorderMutex);
+  size_t count = recorded.size() < maxDurations ? recorded.size() : maxDurations;
+  for (size_t i = 0; i < count; i++)
+  {
+    durations[i] = recorded[i];
+  }
+  return count;
+}
+
+uint32_t irRecordedFrames()
+{
+  std::lock_guard<std::mutex> lock(recorderMutex);
+  return recordedFrames;
+}
+
+void irRecorderClear()
+{
+  std::lock_guard<std::mutex> lock(recorderMutex);
+  recorded.clear();
+  recordedFrames = 0;
+}
@@ -0,0 +1,47 @@
+/*
+ *  IRremote.hpp
+ *
+ *  IRremote sender for the native environment. Nothing is emitted: every frame is logged to
+ *  Serial and its marks and spaces are recorded with the timing ir_NEC.hpp would produce, so the
+ *  host can check what the firmware sends. Sending takes as long as on the air unless
+ *  NATIVE_IR_REALTIME=0 is set in the environment.
+ */
+#ifndef NATIVE_IRREMOTE_HPP
+#define NATIVE_IRREMOTE_HPP
+
+#include <Arduino.h>
+
+#define VERSION_IRREMOTE "4.2.0-native"
+
+#define ENABLE_LED_FEEDBACK true
+#define DISABLE_LED_FEEDBACK false
+#define USE_DEFAULT_FEEDBACK_LED_PIN 0
+
+class IRsend
+{
+public:
+  void begin();
+  void begin(uint_fast8_t aSendPin, bool aEnableLEDFeedback = true, uint_fast8_t aFeedbackLEDPin = 0);
+  void setSendPin(uint_fast8_t aSendPin) { sendPin = aSendPin; }
+
+  void sendNECRaw(uint32_t aRawData, int_fast8_t aNumberOfRepeats = 0);
+  void sendNEC(uint16_t aAddress, uint16_t aCommand, int_fast8_t aNumberOfRepeats = 0);
+  void sendNECSpecialRepeat();
+  void sendNECRepeat(); // Repeat burst on its own, as sent while a key is held
+
+  void mark(unsigned int aMarkMicros); // unsigned int so gaps between repeats (about 98 ms) fit
+  void space(unsigned int aSpaceMicros);
+
+private:
+  uint_fast8_t sendPin = 0;
+};
+
+extern IRsend IrSender;
+
+// Host only: the recorded marks (positive) and spaces (negative) in microseconds, oldest first.
+// Returns how many were copied; the recorder keeps the last 65536.
+size_t irRecordedDurations(int32_t *durations, size_t maxDurations);
+uint32_t irRecordedFrames(); // NEC frames and repeat bursts sent since the last clear
+void irRecorderClear();
+
+#endif // NATIVE_IRREMOTE_HPP
@@ -0,0 +1,195 @@
+#include "Preferences.h"
+
+#include <errno.h>
+#include <sys/stat.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#define NVS_KEY_NAME_MAX_SIZE 16 // Including the terminating zero
+
+typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+
+static std::mutex nvsMutex;
+static std::map<std::string, Namespace> namespaces;
+
+static std::string nvsDirectory()
+{
+  const char *directory = getenv("NATIVE_NVS_DIR");
+  return directory != nullptr ? directory : ".pio/native_nvs";
+}
+
+static std::string namespacePath(const std::string &name)
+{
+  return nvsDirectory() + "/" + name + ".nvs";
+}
+
+// File format: per entry a key length byte, the key, a 32 bit length and the value
+static void load(const std::string &name, Namespace &entries)
+{
+  FILE *file = fopen(namespacePath(name).c_str(), "rb");
+  if (file == nullptr)
+  {
+    return;
+  }
+  uint8_t keyLength;
+  while (fread(&keyLength, 1, 1, file) == 1)
+  {
+    std::string key(keyLength, '\0');
+    uint32_t length;
+    if (fread(&key[0], 1, keyLength, file) != keyLength || fread(&length, sizeof(length), 1, file) != 1)
+    {
+      break;
+    }
+    std::vector<uint8_t> value(length);
+    if (length > 0 && fread(value.data(), 1, length, file) != length)
+    {
+      break;
+    }
+    entries[key] = value;
+  }
+  fclose(file);
+}
+
+static void save(const std::string &name, const Namespace &entries)
+{
+  std::string directory = nvsDirectory();
+  for (size_t slash = directory.find('/', 1); slash != std::string::npos; slash = directory.find('/', slash + 1))
+  {
+    mkdir(directory.substr(0, slash).c_str(), 0755);
+  }
+  mkdir(directory.c_str(), 0755);
+
+  // Written to a temporary file and renamed, a killed host program leaves the old contents
+  std::string path = namespacePath(name);
+  std::string temporary = path + ".tmp";
+  FILE *file = fopen(temporary.c_str(), "wb");
+  if (file == nullptr)
+  {
+    return;
+  }
+  for (const auto &entry : entries)
+  {
+    uint8_t keyLength = entry.first.size();
+    uint32_t length = entry.second.size();
+    fwrite(&keyLength, 1, 1, file);
+    fwrite(entry.first.data(), 1, keyLength, file);
+    fwrite(&length, sizeof(length), 1, file);
+    fwrite(entry.second.data(), 1, length, file);
+  }
+  fclose(file);
+  rename(temporary.c_str(), path.c_str());
+}
+
+static bool validKey(const char *key)
+{
+  return key != nullptr && *key != '\0' && strlen(key) < NVS_KEY_NAME_MAX_SIZE;
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partitionLabel)
+{
+  if (started || name == nullptr || !validKey(name))
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  if (namespaces.find(name) == namespaces.end())
+  {
+    load(name, namespaces[name]);
+  }
+  this->name = name;
+  this->readOnly = readOnly;
+  started = true;
+  return true;
+}
+
+void Preferences::end()
+{
+  started = false;
+}
+
+bool Preferences::clear()
+{
+  if (!started || readOnly)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  namespaces[name].clear();
+  save(name, namespaces[name]);
+  return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+  if (!started || readOnly || !validKey(key))
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  if (namespaces[name].erase(key) == 0)
+  {
+    return false;
+  }
+  save(name, namespaces[name]);
+  return true;
+}
+
+bool Preferences::isKey(const char *key)
+{
+  return getBytesLength(key) > 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t length)
+{
+  if (!started || readOnly || !validKey(key) || (value == nullptr && length > 0))
+  {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  const uint8_t *bytes = (const uint8_t *)value;
+  namespaces[name][key].assign(bytes, bytes + length);
+  save(name, namespaces[name]);
+  return length;
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+  if (!started || !validKey(key))
+  {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  const Namespace &entries = namespaces[name];
+  auto entry = entries.find(key);
+  return entry != entries.end() ? entry->second.size() : 0;
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer, size_t maxLength)
+{
+  if (!started || !validKey(key))
+  {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  const Namespace &entries = namespaces[name];
+  auto entry = entries.find(key);
+  // Like NVS nothing is copied if the value does not fit
+  if (entry == entries.end() || entry->second.size() > maxLength)
+  {
+    return 0;
+  }
+  memcpy(buffer, entry->second.data(), entry->second.size());
+  return entry->second.size();
+}
+
+size_t Preferences::getString(const char *key, char *value, size_t maxLength)
+{
+  size_t length = getBytes(key, value, maxLength);
+  if (length == 0 || value[length - 1] != '\0')
+  {
+    return 0;
+  }
+  return length;
+}
@@ -0,0 +1,58 @@
+/*
+ *  Preferences.h
+ *
+ *  NVS for the native environment. Each namespace is kept in memory and written through to a
+ *  file in NATIVE_NVS_DIR (default .pio/native_nvs), so settings survive a restart of the host
+ *  program like they survive a reboot of the board. Keys are limited to 15 characters as in NVS.
+ */
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+
+#include <string>
+
+class Preferences
+{
+public:
+  bool begin(const char *name, bool readOnly = false, const char *partitionLabel = nullptr);
+  void end();
+
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putUChar(const char *key, uint8_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putUShort(const char *key, uint16_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putInt(const char *key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putUInt(const char *key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putULong64(const char *key, uint64_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putBool(const char *key, bool value) { return putUChar(key, value ? 1 : 0); }
+  size_t putString(const char *key, const char *value) { return putBytes(key, value, strlen(value) + 1); }
+  size_t putBytes(const char *key, const void *value, size_t length);
+
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0) { return get(key, defaultValue); }
+  uint16_t getUShort(const char *key, uint16_t defaultValue = 0) { return get(key, defaultValue); }
+  int32_t getInt(const char *key, int32_t defaultValue = 0) { return get(key, defaultValue); }
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0) { return get(key, defaultValue); }
+  uint64_t getULong64(const char *key, uint64_t defaultValue = 0) { return get(key, defaultValue); }
+  bool getBool(const char *key, bool defaultValue = false) { return getUChar(key, defaultValue ? 1 : 0) != 0; }
+  size_t getString(const char *key, char *value, size_t maxLength);
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buffer, size_t maxLength);
+
+private:
+  // Values of the wrong size read as the default, like a type mismatch in NVS
+  template <typename T>
+  T get(const char *key, T defaultValue)
+  {
+    T value;
+    return getBytesLength(key) == sizeof(T) && getBytes(key, &value, sizeof(T)) == sizeof(T) ? value : defaultValue;
+  }
+
+  std::string name;
+  bool started = false;
+  bool readOnly = false;
+};
+
+#endif // NATIVE_PREFERENCES_H
@@ -0,0 +1,97 @@
+/*
+ *  WString.h
+ *
+ *  Arduino String for the native environment, a thin wrapper of std::string. Like the real one
+ *  it allocates on the heap, so host profiles of code still using String show those allocations.
+ */
+#ifndef NATIVE_WSTRING_H
+#define NATIVE_WSTRING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <string>
+
+class String
+{
+public:
+  String(const char *text = "") : value(text != nullptr ? text : "") {}
+  String(const std::string &text) : value(text) {}
+  explicit String(char c) : value(1, c) {}
+  String(int number, unsigned char base = 10) : String((long)number, base) {}
+  String(unsigned int number, unsigned char base = 10) : String((unsigned long)number, base) {}
+  String(long number, unsigned char base = 10);
+  String(unsigned long number, unsigned char base = 10);
+  String(double number, unsigned char decimals = 2);
+
+  const char *c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.size(); }
+  bool isEmpty() const { return value.empty(); }
+  bool reserve(unsigned int size)
+  {
+    value.reserve(size);
+    return true;
+  }
+
+  char charAt(unsigned int index) const { return index < value.size() ? value[index] : '\0'; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index) { return value[index]; }
+
+  bool concat(const String &text)
+  {
+    value += text.value;
+    return true;
+  }
+  String &operator+=(const String &text)
+  {
+    value += text.value;
+    return *this;
+  }
+  String &operator+=(const char *text)
+  {
+    value += text;
+    return *this;
+  }
+  String &operator+=(char c)
+  {
+    value += c;
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) { return String(a.value + b.value); }
+  friend String operator+(const String &a, const char *b) { return String(a.value + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.value); }
+  friend String operator+(const String &a, char b) { return String(a.value + b); }
+
+  bool equals(const String &text) const { return value == text.value; }
+  bool operator==(const String &text) const { return value == text.value; }
+  bool operator==(const char *text) const { return value == text; }
+  bool operator!=(const String &text) const { return value != text.value; }
+  bool operator!=(const char *text) const { return value != text; }
+  bool startsWith(const String &prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+  bool endsWith(const String &suffix) const
+  {
+    return value.size() >= suffix.value.size() &&
+           value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return position(value.find(c, from)); }
+  int indexOf(const String &text, unsigned int from = 0) const { return position(value.find(text.value, from)); }
+  int lastIndexOf(char c) const { return position(value.rfind(c)); }
+  String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const
+  {
+    return from < to && from < value.size() ? String(value.substr(from, to - from)) : String();
+  }
+
+  long toInt() const { return atol(value.c_str()); }
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+
+private:
+  static int position(size_t index) { return index == std::string::npos ? -1 : (int)index; }
+
+  std::string value;
+};
+
+#endif // NATIVE_WSTRING_H
@@ -0,0 +1,284 @@
+#include "WiFi.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+#define WRITE_TIMEOUT_MS 3000 // WIFI_CLIENT_DEF_CONN_TIMEOUT_MS of the ESP32 core
+
+struct NativeSocket
+{
+  int fd;
+  bool open = true;
+  uint32_t writeTimeoutMs = WRITE_TIMEOUT_MS;
+
+  explicit NativeSocket(int fd) : fd(fd) {}
+  ~NativeSocket() { close(); }
+
+  void close()
+  {
+    if (fd >= 0)
+    {
+      ::close(fd);
+      fd = -1;
+    }
+    open = false;
+  }
+};
+
+IPAddress::IPAddress(uint32_t address)
+{
+  memcpy(bytes, &address, sizeof(bytes));
+}
+
+String IPAddress::toString() const
+{
+  char text[16];
+  snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+  return String(text);
+}
+
+size_t IPAddress::printTo(Print &p) const
+{
+  return p.print(toString());
+}
+
+bool WiFiClass::softAP(const char *ssid, const char *passphrase, int channel, int hidden, int maxConnection)
+{
+  Serial.printf("[native] soft AP \"%s\" is the host network\n", ssid);
+  return true;
+}
+
+WiFiClient::WiFiClient(int fd) : socket(std::make_shared<NativeSocket>(fd))
+{
+}
+
+bool WiFiClient::connected_() const
+{
+  return socket && socket->open;
+}
+
+int WiFiClient::fd() const
+{
+  return connected_() ? socket->fd : -1;
+}
+
+size_t WiFiClient::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+  if (!connected_())
+  {
+    return 0;
+  }
+  size_t sent = 0;
+  while (sent < size)
+  {
+    ssize_t n = send(socket->fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n > 0)
+    {
+      sent += n;
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+    {
+      struct pollfd pfd = {socket->fd, POLLOUT, 0};
+      if (poll(&pfd, 1, socket->writeTimeoutMs) > 0)
+      {
+        continue;
+      }
+    }
+    // Timed out or the peer is gone, like the ESP32 core the client is stopped
+    stop();
+    break;
+  }
+  return sent;
+}
+
+int WiFiClient::available()
+{
+  int count = 0;
+  if (!connected_() || ioctl(socket->fd, FIONREAD, &count) < 0)
+  {
+    return 0;
+  }
+  return count;
+}
+
+int WiFiClient::read()
+{
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+  if (!connected_())
+  {
+    return -1;
+  }
+  ssize_t n = recv(socket->fd, buffer, size, MSG_DONTWAIT);
+  if (n > 0)
+  {
+    return n;
+  }
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+  {
+    return 0;
+  }
+  stop();
+  return -1;
+}
+
+int WiFiClient::peek()
+{
+  uint8_t c;
+  if (!connected_() || recv(socket->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 1)
+  {
+    return -1;
+  }
+  return c;
+}
+
+uint8_t WiFiClient::connected()
+{
+  if (!connected_())
+  {
+    return 0;
+  }
+  uint8_t c;
+  ssize_t n = recv(socket->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+  {
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+// Like the ESP32 core this only drops this copy's reference, the socket closes with the last one
+void WiFiClient::stop()
+{
+  socket.reset();
+}
+
+void WiFiClient::setNoDelay(bool noDelay)
+{
+  int flag = noDelay ? 1 : 0;
+  if (connected_())
+  {
+    setsockopt(socket->fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+  }
+}
+
+void WiFiClient::setTimeout(uint32_t seconds)
+{
+  if (socket)
+  {
+    socket->writeTimeoutMs = seconds * 1000;
+  }
+}
+
+IPAddress WiFiClient::remoteIP() const
+{
+  struct sockaddr_in address = {};
+  socklen_t length = sizeof(address);
+  if (!connected_() || getpeername(socket->fd, (struct sockaddr *)&address, &length) < 0)
+  {
+    return IPAddress();
+  }
+  return IPAddress((uint32_t)address.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort() const
+{
+  struct sockaddr_in address = {};
+  socklen_t length = sizeof(address);
+  if (!connected_() || getpeername(socket->fd, (struct sockaddr *)&address, &length) < 0)
+  {
+    return 0;
+  }
+  return ntohs(address.sin_port);
+}
+
+void WiFiServer::begin(uint16_t port)
+{
+  if (port != 0)
+  {
+    this->port = port;
+  }
+  listenPort = this->port < 1024 ? this->port + 8000 : this->port;
+  const char *override = getenv("NATIVE_HTTP_PORT");
+  if (override != nullptr && atoi(override) > 0)
+  {
+    listenPort = atoi(override);
+  }
+
+  listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listenFd < 0)
+  {
+    perror("[native] socket");
+    return;
+  }
+  int reuse = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  struct sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(listenPort);
+  if (bind(listenFd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(listenFd, SOMAXCONN) < 0)
+  {
+    perror("[native] bind");
+    ::close(listenFd);
+    listenFd = -1;
+    return;
+  }
+  Serial.printf("[native] WiFiServer(%u) listening on port %u\n", this->port, listenPort);
+}
+
+void WiFiServer::end()
+{
+  if (listenFd >= 0)
+  {
+    ::close(listenFd);
+    listenFd = -1;
+  }
+}
+
+bool WiFiServer::hasClient()
+{
+  struct pollfd pfd = {listenFd, POLLIN, 0};
+  return listenFd >= 0 && poll(&pfd, 1, 0) > 0;
+}
+
+WiFiClient WiFiServer::available()
+{
+  if (listenFd < 0)
+  {
+    return WiFiClient();
+  }
+  struct pollfd pfd = {listenFd, POLLIN, 0};
+  if (poll(&pfd, 1, 1) <= 0)
+  {
+    return WiFiClient();
+  }
+  int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+  if (fd < 0)
+  {
+    return WiFiClient();
+  }
+  WiFiClient client(fd);
+  client.setNoDelay(noDelay);
+  return client;
+}
@@ -0,0 +1,110 @@
+/*
+ *  WiFi.h
+ *
+ *  WiFi for the native environment: the soft AP is the host's network, WiFiServer and WiFiClient
+ *  are non-blocking POSIX TCP sockets with the semantics of the ESP32 core (copies of a client
+ *  share its socket which closes when the last copy is stopped or destroyed, read() returns 0
+ *  when nothing is there yet).
+ *
+ *  Privileged ports are moved up by 8000, WiFiServer(80) listens on 8080. NATIVE_HTTP_PORT in
+ *  the environment overrides the port of every server.
+ */
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+
+#include <memory>
+
+class IPAddress : public Printable
+{
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : bytes{a, b, c, d} {}
+  explicit IPAddress(uint32_t address); // Network byte order, as in sockaddr_in
+  uint8_t operator[](int index) const { return bytes[index]; }
+  String toString() const;
+  size_t printTo(Print &p) const override;
+
+private:
+  uint8_t bytes[4];
+};
+
+struct NativeSocket;
+
+class WiFiClient : public Print
+{
+public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  int available();
+  int read();
+  int read(uint8_t *buffer, size_t size); // Bytes read, 0 if none yet, -1 after the peer closed
+  int peek();
+  uint8_t connected();
+  void stop();
+  void setNoDelay(bool noDelay);
+  void setTimeout(uint32_t seconds);
+  int fd() const;
+  IPAddress remoteIP() const;
+  uint16_t remotePort() const;
+
+  operator bool() const { return connected_(); }
+  bool operator==(const WiFiClient &other) const { return socket == other.socket; }
+  bool operator!=(const WiFiClient &other) const { return socket != other.socket; }
+
+private:
+  bool connected_() const;
+
+  std::shared_ptr<NativeSocket> socket;
+};
+
+class WiFiServer
+{
+public:
+  WiFiServer(uint16_t port = 80, uint8_t maxClients = 4) : port(port), maxClients(maxClients) {}
+  ~WiFiServer() { end(); }
+
+  void begin(uint16_t port = 0);
+  void end();
+  void setNoDelay(bool noDelay) { this->noDelay = noDelay; }
+  bool hasClient();
+  WiFiClient available(); // Waits up to 1 ms for a connection so an idle loop() does not spin a core
+  WiFiClient accept() { return available(); }
+  uint16_t boundPort() const { return listenPort; }
+  operator bool() const { return listenFd >= 0; }
+
+private:
+  uint16_t port;
+  uint16_t listenPort = 0;
+  uint8_t maxClients;
+  int listenFd = -1;
+  bool noDelay = false;
+};
+
+typedef enum
+{
+  WIFI_OFF,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA
+} wifi_mode_t;
+
+class WiFiClass
+{
+public:
+  bool mode(wifi_mode_t mode) { return true; }
+  bool softAP(const char *ssid, const char *passphrase = nullptr, int channel = 1, int hidden = 0,
+              int maxConnection = 4);
+  bool softAPdisconnect(bool wifiOff = false) { return true; }
+  IPAddress softAPIP() { return IPAddress(127, 0, 0, 1); }
+  uint8_t softAPgetStationNum() { return 0; }
+  bool setSleep(bool enabled) { return true; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // NATIVE_WIFI_H
@@ -0,0 +1,87 @@
+/*
+ *  driver/rmt.h
+ *
+ *  Legacy RMT transmit driver of ESP-IDF 4 for the native environment, so the RMT backend
+ *  (IR_BACKEND_RMT) runs on the host. Nothing is emitted: every rmt_write_items() is logged and
+ *  keeps its channel busy for as long as the items last, channels run side by side like the
+ *  peripheral's. Sending takes no time if NATIVE_IR_REALTIME=0 is set in the environment.
+ */
+#ifndef NATIVE_DRIVER_RMT_H
+#define NATIVE_DRIVER_RMT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef int gpio_num_t;
+
+typedef enum
+{
+  RMT_CHANNEL_0,
+  RMT_CHANNEL_1,
+  RMT_CHANNEL_2,
+  RMT_CHANNEL_3,
+  RMT_CHANNEL_4,
+  RMT_CHANNEL_5,
+  RMT_CHANNEL_6,
+  RMT_CHANNEL_7,
+  RMT_CHANNEL_MAX
+} rmt_channel_t;
+
+typedef enum
+{
+  RMT_MODE_TX,
+  RMT_MODE_RX
+} rmt_mode_t;
+
+typedef enum
+{
+  RMT_CARRIER_LEVEL_LOW,
+  RMT_CARRIER_LEVEL_HIGH
+} rmt_carrier_level_t;
+
+typedef enum
+{
+  RMT_IDLE_LEVEL_LOW,
+  RMT_IDLE_LEVEL_HIGH
+} rmt_idle_level_t;
+
+typedef struct
+{
+  uint32_t carrier_freq_hz;
+  rmt_carrier_level_t carrier_level;
+  rmt_idle_level_t idle_level;
+  uint8_t carrier_duty_percent;
+  bool carrier_en;
+  bool loop_en;
+  bool idle_output_en;
+} rmt_tx_config_t;
+
+typedef struct
+{
+  rmt_mode_t rmt_mode;
+  rmt_channel_t channel;
+  gpio_num_t gpio_num;
+  uint8_t clk_div;
+  uint8_t mem_block_num;
+  rmt_tx_config_t tx_config;
+} rmt_config_t;
+
+typedef struct
+{
+  uint32_t val; // Two halves of 15 bit duration and a level bit each
+} rmt_item32_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id)                                                                      \
+  {                                                                                                                  \
+    RMT_MODE_TX, channel_id, gpio, 80, 1, { 38000, RMT_CARRIER_LEVEL_HIGH, RMT_IDLE_LEVEL_LOW, 33, true, false, true } \
+  }
+
+esp_err_t rmt_config(const rmt_config_t *rmt_param);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rx_buf_size, int intr_alloc_flags);
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *rmt_item, int item_num, bool wait_tx_done);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait_time);
+
+#endif // NATIVE_DRIVER_RMT_H
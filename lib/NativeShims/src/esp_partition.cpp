@@ -0,0 +1,73 @@
+#include "esp_partition.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <mutex>
+
+static std::mutex partitionMutex;
+static esp_partition_t codeDbPartition;
+static void *mapped = nullptr;
+
+static const char *codeDbPath()
+{
+  const char *path = getenv("NATIVE_CODEDB");
+  return path != nullptr ? path : ".pio/codedb.bin";
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+  struct stat status;
+  if (type != ESP_PARTITION_TYPE_DATA || label == nullptr || strcmp(label, "codedb") != 0 ||
+      stat(codeDbPath(), &status) != 0)
+  {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(partitionMutex);
+  codeDbPartition.type = type;
+  codeDbPartition.subtype = subtype;
+  codeDbPartition.address = 0x3E0000;
+  codeDbPartition.size = status.st_size;
+  strcpy(codeDbPartition.label, "codedb");
+  return &codeDbPartition;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void **out_ptr, spi_flash_mmap_handle_t *out_handle)
+{
+  if (partition != &codeDbPartition || offset + size > partition->size || size == 0)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  std::lock_guard<std::mutex> lock(partitionMutex);
+  int fd = open(codeDbPath(), O_RDONLY);
+  if (fd < 0)
+  {
+    return ESP_FAIL;
+  }
+  void *data = mmap(nullptr, partition->size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    return ESP_FAIL;
+  }
+  mapped = data;
+  *out_ptr = (const uint8_t *)data + offset;
+  *out_handle = 1;
+  return ESP_OK;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle)
+{
+  std::lock_guard<std::mutex> lock(partitionMutex);
+  if (handle == 1 && mapped != nullptr)
+  {
+    munmap(mapped, codeDbPartition.size);
+    mapped = nullptr;
+  }
+}
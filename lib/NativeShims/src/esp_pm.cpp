@@ -0,0 +1,55 @@
+#include "esp_pm.h"
+
+#include <atomic>
+
+struct NativePmLock
+{
+  esp_pm_lock_type_t type;
+  const char *name;
+  std::atomic<int> count;
+};
+
+esp_err_t esp_pm_configure(const void *config)
+{
+  const esp_pm_config_esp32_t *pm = (const esp_pm_config_esp32_t *)config;
+  if (pm == nullptr || pm->min_freq_mhz > pm->max_freq_mhz)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_create(esp_pm_lock_type_t lock_type, int arg, const char *name, esp_pm_lock_handle_t *out_handle)
+{
+  if (out_handle == nullptr)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  *out_handle = new NativePmLock{lock_type, name, {0}};
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle)
+{
+  if (handle == nullptr)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  handle->count++;
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle)
+{
+  if (handle == nullptr)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  // Like the driver, releasing a lock that is not held is an error
+  if (handle->count.fetch_sub(1) <= 0)
+  {
+    handle->count++;
+    return ESP_ERR_INVALID_STATE;
+  }
+  return ESP_OK;
+}
@@ -0,0 +1,9 @@
+#ifndef NATIVE_ESP_TIMER_H
+#define NATIVE_ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microseconds since the program started, from the host's monotonic clock
+int64_t esp_timer_get_time();
+
+#endif // NATIVE_ESP_TIMER_H
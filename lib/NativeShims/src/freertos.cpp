@@ -0,0 +1,407 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct NativeTask
+{
+  std::string name;
+  TaskFunction_t code;
+  void *parameter;
+  uint32_t stackDepth;
+  UBaseType_t priority;
+  BaseType_t core;
+
+  std::mutex mutex;
+  std::condition_variable notified;
+  uint32_t notifyValue = 0;
+  bool notifyPending = false;
+};
+
+struct NativeQueue
+{
+  std::mutex mutex;
+  std::condition_variable notEmpty;
+  std::condition_variable notFull;
+  std::vector<uint8_t> items; // Ring of length items, empty for semaphores
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t head = 0;
+  UBaseType_t count = 0;
+};
+
+static thread_local NativeTask *currentTask = nullptr;
+static const std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+
+// Waits on condition until ready() or the ticks ran out, portMAX_DELAY waits forever
+template <typename Ready>
+static bool waitTicks(std::condition_variable &condition, std::unique_lock<std::mutex> &lock, TickType_t ticks,
+                      Ready ready)
+{
+  if (ticks == portMAX_DELAY)
+  {
+    condition.wait(lock, ready);
+    return true;
+  }
+  return condition.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), ready);
+}
+
+static void *taskEntry(void *argument)
+{
+  NativeTask *task = (NativeTask *)argument;
+  currentTask = task;
+  pthread_setname_np(pthread_self(), task->name.substr(0, 15).c_str());
+  task->code(task->parameter);
+  // A FreeRTOS task must not return, treat it like vTaskDelete(NULL)
+  return nullptr;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char *pcName, uint32_t usStackDepth,
+                                   void *pvParameters, UBaseType_t uxPriority, TaskHandle_t *pvCreatedTask,
+                                   BaseType_t xCoreID)
+{
+  NativeTask *task = new NativeTask();
+  task->name = pcName != nullptr ? pcName : "";
+  task->code = pvTaskCode;
+  task->parameter = pvParameters;
+  task->stackDepth = usStackDepth;
+  task->priority = uxPriority;
+  task->core = xCoreID;
+  if (pvCreatedTask != nullptr)
+  {
+    *pvCreatedTask = task;
+  }
+
+  pthread_t thread;
+  if (pthread_create(&thread, nullptr, taskEntry, task) != 0)
+  {
+    delete task;
+    if (pvCreatedTask != nullptr)
+    {
+      *pvCreatedTask = nullptr;
+    }
+    return pdFAIL;
+  }
+  pthread_detach(thread);
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char *pcName, uint32_t usStackDepth, void *pvParameters,
+                       UBaseType_t uxPriority, TaskHandle_t *pvCreatedTask)
+{
+  return xTaskCreatePinnedToCore(pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pvCreatedTask,
+                                 tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t xTask)
+{
+  if (xTask == nullptr || xTask == currentTask)
+  {
+    // The handle stays allocated, other tasks may still hold it
+    pthread_exit(nullptr);
+  }
+}
+
+void vTaskDelay(TickType_t xTicksToDelay)
+{
+  if (xTicksToDelay == 0)
+  {
+    sched_yield();
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay * portTICK_PERIOD_MS));
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return (TickType_t)(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - tickStart)
+                          .count() /
+                      portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  if (currentTask == nullptr)
+  {
+    // Threads not started by xTaskCreate, main() running setup() and loop() is the Arduino loopTask
+    currentTask = new NativeTask();
+    currentTask->name = "loopTask";
+    currentTask->code = nullptr;
+    currentTask->parameter = nullptr;
+    currentTask->stackDepth = 8192;
+    currentTask->priority = 1;
+    currentTask->core = 1;
+  }
+  return currentTask;
+}
+
+static NativeTask *taskOrCurrent(TaskHandle_t xTask)
+{
+  return xTask != nullptr ? xTask : xTaskGetCurrentTaskHandle();
+}
+
+const char *pcTaskGetName(TaskHandle_t xTask)
+{
+  return taskOrCurrent(xTask)->name.c_str();
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask)
+{
+  return taskOrCurrent(xTask)->priority;
+}
+
+BaseType_t xTaskGetAffinity(TaskHandle_t xTask)
+{
+  return taskOrCurrent(xTask)->core;
+}
+
+BaseType_t xPortGetCoreID()
+{
+  BaseType_t core = xTaskGetCurrentTaskHandle()->core;
+  return core == tskNO_AFFINITY ? 0 : core;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask)
+{
+  return taskOrCurrent(xTask)->stackDepth;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction)
+{
+  NativeTask *task = xTaskToNotify;
+  std::lock_guard<std::mutex> lock(task->mutex);
+  switch (eAction)
+  {
+  case eSetBits:
+    task->notifyValue |= ulValue;
+    break;
+  case eIncrement:
+    task->notifyValue++;
+    break;
+  case eSetValueWithOverwrite:
+    task->notifyValue = ulValue;
+    break;
+  case eSetValueWithoutOverwrite:
+    if (task->notifyPending)
+    {
+      return pdFAIL;
+    }
+    task->notifyValue = ulValue;
+    break;
+  case eNoAction:
+    break;
+  }
+  task->notifyPending = true;
+  task->notified.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+  return xTaskNotify(xTaskToNotify, 0, eIncrement);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+  NativeTask *task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->mutex);
+  waitTicks(task->notified, lock, xTicksToWait, [task] { return task->notifyValue != 0; });
+  uint32_t value = task->notifyValue;
+  if (value != 0)
+  {
+    task->notifyValue = xClearCountOnExit ? 0 : value - 1;
+  }
+  task->notifyPending = false;
+  return value;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue,
+                           TickType_t xTicksToWait)
+{
+  NativeTask *task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->mutex);
+  if (!task->notifyPending)
+  {
+    task->notifyValue &= ~ulBitsToClearOnEntry;
+  }
+  bool received = waitTicks(task->notified, lock, xTicksToWait, [task] { return task->notifyPending; });
+  if (pulNotificationValue != nullptr)
+  {
+    *pulNotificationValue = task->notifyValue;
+  }
+  if (!received)
+  {
+    return pdFALSE;
+  }
+  task->notifyValue &= ~ulBitsToClearOnExit;
+  task->notifyPending = false;
+  return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+  if (uxQueueLength == 0)
+  {
+    return nullptr;
+  }
+  NativeQueue *queue = new NativeQueue();
+  queue->length = uxQueueLength;
+  queue->itemSize = uxItemSize;
+  queue->items.resize((size_t)uxQueueLength * uxItemSize);
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t xQueue)
+{
+  delete xQueue;
+}
+
+static BaseType_t queueSend(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait, bool front)
+{
+  std::unique_lock<std::mutex> lock(xQueue->mutex);
+  if (!waitTicks(xQueue->notFull, lock, xTicksToWait, [xQueue] { return xQueue->count < xQueue->length; }))
+  {
+    return pdFALSE; // errQUEUE_FULL
+  }
+  UBaseType_t slot;
+  if (front)
+  {
+    xQueue->head = (xQueue->head + xQueue->length - 1) % xQueue->length;
+    slot = xQueue->head;
+  }
+  else
+  {
+    slot = (xQueue->head + xQueue->count) % xQueue->length;
+  }
+  if (xQueue->itemSize > 0)
+  {
+    memcpy(&xQueue->items[(size_t)slot * xQueue->itemSize], pvItemToQueue, xQueue->itemSize);
+  }
+  xQueue->count++;
+  xQueue->notEmpty.notify_one();
+  return pdTRUE;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait)
+{
+  return queueSend(xQueue, pvItemToQueue, xTicksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait)
+{
+  return queueSend(xQueue, pvItemToQueue, xTicksToWait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t xQueue, const void *pvItemToQueue)
+{
+  std::lock_guard<std::mutex> lock(xQueue->mutex);
+  if (xQueue->itemSize > 0)
+  {
+    memcpy(&xQueue->items[(size_t)xQueue->head * xQueue->itemSize], pvItemToQueue, xQueue->itemSize);
+  }
+  xQueue->count = 1;
+  xQueue->notEmpty.notify_one();
+  return pdPASS;
+}
+
+static BaseType_t queueReceive(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait, bool remove)
+{
+  std::unique_lock<std::mutex> lock(xQueue->mutex);
+  if (!waitTicks(xQueue->notEmpty, lock, xTicksToWait, [xQueue] { return xQueue->count > 0; }))
+  {
+    return pdFALSE;
+  }
+  if (xQueue->itemSize > 0)
+  {
+    memcpy(pvBuffer, &xQueue->items[(size_t)xQueue->head * xQueue->itemSize], xQueue->itemSize);
+  }
+  if (remove)
+  {
+    xQueue->head = (xQueue->head + 1) % xQueue->length;
+    xQueue->count--;
+    xQueue->notFull.notify_one();
+  }
+  else
+  {
+    xQueue->notEmpty.notify_one(); // A peek leaves the item to the next waiting receiver
+  }
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait)
+{
+  return queueReceive(xQueue, pvBuffer, xTicksToWait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait)
+{
+  return queueReceive(xQueue, pvBuffer, xTicksToWait, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t xQueue)
+{
+  std::lock_guard<std::mutex> lock(xQueue->mutex);
+  xQueue->head = 0;
+  xQueue->count = 0;
+  xQueue->notFull.notify_all();
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t xQueue)
+{
+  std::lock_guard<std::mutex> lock(xQueue->mutex);
+  return xQueue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t xQueue)
+{
+  std::lock_guard<std::mutex> lock(xQueue->mutex);
+  return xQueue->length - xQueue->count;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount)
+{
+  QueueHandle_t semaphore = xQueueCreate(uxMaxCount, 0);
+  if (semaphore != nullptr)
+  {
+    semaphore->count = uxInitialCount < uxMaxCount ? uxInitialCount : uxMaxCount;
+  }
+  return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return xSemaphoreCreateCounting(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+  // No priority inheritance or owner check, a plain binary semaphore that starts given
+  return xSemaphoreCreateCounting(1, 1);
+}
+
+void vPortEnterCritical(portMUX_TYPE *mux)
+{
+  int unlocked = 0;
+  while (!__atomic_compare_exchange_n(&mux->owner, &unlocked, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+  {
+    unlocked = 0;
+    sched_yield();
+  }
+}
+
+void vPortExitCritical(portMUX_TYPE *mux)
+{
+  __atomic_store_n(&mux->owner, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,18 @@
+#ifndef NATIVE_FREERTOS_SEMPHR_H
+#define NATIVE_FREERTOS_SEMPHR_H
+
+#include "queue.h"
+
+// As in FreeRTOS a semaphore is a queue of zero sized items, taking receives and giving sends
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount);
+
+#define xSemaphoreTake(xSemaphore, xBlockTime) xQueueReceive(xSemaphore, NULL, xBlockTime)
+#define xSemaphoreGive(xSemaphore) xQueueSendToBack(xSemaphore, NULL, 0)
+#define uxSemaphoreGetCount(xSemaphore) uxQueueMessagesWaiting(xSemaphore)
+#define vSemaphoreDelete(xSemaphore) vQueueDelete(xSemaphore)
+
+#endif // NATIVE_FREERTOS_SEMPHR_H
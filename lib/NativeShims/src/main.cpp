@@ -0,0 +1,18 @@
+#include "Arduino.h"
+
+#include <signal.h>
+
+// Like the ESP32 core's loopTask: setup() once, then loop() forever. It lives in its own object
+// file, so a host program with its own main() (benchmarks, tests) does not pull it in.
+int main(int argc, char **argv)
+{
+  signal(SIGPIPE, SIG_IGN); // A client closing early must not end the program, writes just fail
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+  xTaskGetCurrentTaskHandle();
+  setup();
+  while (1)
+  {
+    loop();
+  }
+  return 0;
+}
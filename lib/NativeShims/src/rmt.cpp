@@ -0,0 +1,120 @@
+#include "driver/rmt.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#include <mutex>
+
+struct NativeRmtChannel
+{
+  rmt_config_t config;
+  bool configured;
+  bool installed;
+  int64_t busyUntil; // esp_timer_get_time() when the last items are out
+};
+
+static std::mutex rmtMutex;
+static NativeRmtChannel channels[RMT_CHANNEL_MAX];
+
+static bool realtime()
+{
+  static const bool enabled = getenv("NATIVE_IR_REALTIME") == nullptr || atoi(getenv("NATIVE_IR_REALTIME")) != 0;
+  return enabled;
+}
+
+esp_err_t rmt_config(const rmt_config_t *rmt_param)
+{
+  if (rmt_param == nullptr || rmt_param->channel >= RMT_CHANNEL_MAX || rmt_param->clk_div == 0)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  std::lock_guard<std::mutex> lock(rmtMutex);
+  channels[rmt_param->channel].config = *rmt_param;
+  channels[rmt_param->channel].configured = true;
+  return ESP_OK;
+}
+
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rx_buf_size, int intr_alloc_flags)
+{
+  if (channel >= RMT_CHANNEL_MAX)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  std::lock_guard<std::mutex> lock(rmtMutex);
+  if (!channels[channel].configured || channels[channel].installed)
+  {
+    return ESP_ERR_INVALID_STATE;
+  }
+  channels[channel].installed = true;
+  return ESP_OK;
+}
+
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait_time)
+{
+  if (channel >= RMT_CHANNEL_MAX)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  int64_t busyUntil;
+  {
+    std::lock_guard<std::mutex> lock(rmtMutex);
+    busyUntil = channels[channel].busyUntil;
+  }
+  int64_t left = busyUntil - esp_timer_get_time();
+  if (left > 0)
+  {
+    if (wait_time != portMAX_DELAY && left > (int64_t)wait_time * portTICK_PERIOD_MS * 1000)
+    {
+      delay(wait_time * portTICK_PERIOD_MS);
+      return ESP_FAIL; // Timeout, like the driver
+    }
+    delayMicroseconds(left);
+  }
+  return ESP_OK;
+}
+
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *rmt_item, int item_num, bool wait_tx_done)
+{
+  if (channel >= RMT_CHANNEL_MAX || rmt_item == nullptr || item_num <= 0)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  // The driver waits for the previous transmission of the channel before it starts the next one
+  rmt_wait_tx_done(channel, portMAX_DELAY);
+  uint64_t ticks = 0;
+  for (int i = 0; i < item_num; i++)
+  {
+    uint32_t first = rmt_item[i].val & 0x7FFF;
+    uint32_t second = (rmt_item[i].val >> 16) & 0x7FFF;
+    ticks += first;
+    if (first == 0)
+    {
+      break;
+    }
+    ticks += second;
+    if (second == 0)
+    {
+      break;
+    }
+  }
+  std::lock_guard<std::mutex> lock(rmtMutex);
+  NativeRmtChannel &state = channels[channel];
+  if (!state.installed)
+  {
+    return ESP_ERR_INVALID_STATE;
+  }
+  // Ticks of the 80 MHz APB clock divided by clk_div
+  uint32_t micros = ticks * state.config.clk_div / 80;
+  Serial.printf("[native] RMT channel %d at pin %d: %d items, %u us\n", (int)channel, state.config.gpio_num, item_num,
+                (unsigned)micros);
+  state.busyUntil = esp_timer_get_time() + (realtime() ? micros : 0);
+  if (wait_tx_done)
+  {
+    int64_t left = state.busyUntil - esp_timer_get_time();
+    if (left > 0)
+    {
+      delayMicroseconds(left);
+    }
+  }
+  return ESP_OK;
+}
@@ -0,0 +1,197 @@
+#include "batch.h"
+
+#include <esp_timer.h>
+
+#include "codeDb.h"
+#include "macro.h"
+
+// One more than batches can be queued, a finished batch's stream may still be waiting for its
+// EVENT_IR_SENT when the next one starts
+#define BATCH_STREAMS (IR_BATCH_SLOTS + 1)
+
+struct BatchStream
+{
+  WiFiClient client;
+  bool open;
+  uint32_t id;
+  uint8_t steps;
+  int64_t startMicros;
+};
+
+static BatchStream streams[BATCH_STREAMS];
+
+// Number after "prefix:" of a token, -1 if the token does not start with it, -2 if it is no number
+static long stepNumber(const char *token, size_t length, const char *prefix)
+{
+  size_t prefixLength = strlen(prefix);
+  if (length <= prefixLength + 1 || strncmp(token, prefix, prefixLength) != 0 || token[prefixLength] != ':')
+  {
+    return -1;
+  }
+  long number = 0;
+  for (size_t i = prefixLength + 1; i < length; i++)
+  {
+    if (token[i] < '0' || token[i] > '9' || number > 100000)
+    {
+      return -2;
+    }
+    number = number * 10 + (token[i] - '0');
+  }
+  return number;
+}
+
+bool batchParse(const char *text, IrBatch &batch, size_t *failedStep, const char **error)
+{
+  static const char separators[] = ", \t\r\n";
+  uint32_t waitMillis = 0;
+  batch.length = 0;
+  batch.tune = false;
+  while (*text != '\0')
+  {
+    if (strchr(separators, *text) != nullptr)
+    {
+      text++;
+      continue;
+    }
+    size_t length = strcspn(text, separators);
+    *failedStep = batch.length;
+    if (batch.length == IR_BATCH_MAX_STEPS)
+    {
+      *error = "too many steps";
+      return false;
+    }
+    IrCommand &step = batch.steps[batch.length];
+    step = {IR_COMMAND_KEY, 0, 0, 0};
+    long number;
+    int key;
+    if ((number = stepNumber(text, length, "channel")) != -1)
+    {
+      if (number < 0 || number > IR_MAX_CHANNEL)
+      {
+        *error = "channel must be 0..999";
+        return false;
+      }
+      step.type = IR_COMMAND_CHANNEL;
+      step.value = number;
+    }
+    else if ((number = stepNumber(text, length, "fave")) != -1)
+    {
+      if (number < 0 || number > 9)
+      {
+        *error = "fave must be 0..9";
+        return false;
+      }
+      step.type = IR_COMMAND_FAVORITE;
+      step.value = number;
+    }
+    else if ((number = stepNumber(text, length, "wait")) != -1)
+    {
+      if (number < 0 || number > UINT16_MAX)
+      {
+        *error = "wait must be 0..65535 ms";
+        return false;
+      }
+      // Same bound as a macro so one batch cannot hog the emitter
+      waitMillis += number;
+      if (waitMillis > MACRO_MAX_MILLIS)
+      {
+        *error = "batch waits too long";
+        return false;
+      }
+      step.type = IR_COMMAND_WAIT;
+      step.value = number;
+    }
+    else if ((key = keyFromName(text, length)) >= 0)
+    {
+      step.value = key;
+    }
+    else if ((key = codeDbFind(text, length)) >= 0)
+    {
+      step.type = IR_COMMAND_CODE;
+      step.value = key;
+    }
+    else
+    {
+      *error = "unknown key or step";
+      return false;
+    }
+    batch.length++;
+    text += length;
+  }
+  if (batch.length == 0)
+  {
+    *failedStep = 0;
+    *error = "no steps";
+    return false;
+  }
+  return true;
+}
+
+static void streamLine(BatchStream &stream, const char *line, int length)
+{
+  if (stream.client.write((const uint8_t *)line, length) != (size_t)length)
+  {
+    // Gone, the batch still runs to the end
+    stream.client.stop();
+    stream.open = false;
+  }
+}
+
+static void streamDone(BatchStream &stream)
+{
+  char line[48];
+  int length = snprintf(line, sizeof(line), "{\"done\":true,\"ms\":%lu}\n",
+                        (unsigned long)((esp_timer_get_time() - stream.startMicros) / 1000));
+  streamLine(stream, line, length);
+  stream.client.stop();
+  stream.open = false;
+}
+
+void batchStreamStart(WiFiClient &client, uint32_t id, uint8_t steps)
+{
+  char response[160];
+  int length = snprintf(response, sizeof(response),
+                        "HTTP/1.1 200 OK\r\nContent-type:application/x-ndjson\r\nCache-Control: no-store\r\n"
+                        "Connection: close\r\n\r\n{\"id\":%lu,\"steps\":%u}\n",
+                        (unsigned long)id, steps);
+  for (BatchStream &stream : streams)
+  {
+    // A batch that is done but whose EVENT_IR_SENT got lost in a full event queue
+    if (stream.open && stream.id <= irLastCompleted())
+    {
+      streamDone(stream);
+    }
+    if (!stream.open)
+    {
+      stream = {client, true, id, steps, esp_timer_get_time()};
+      streamLine(stream, response, length);
+      return;
+    }
+  }
+  // No stream free, the caller closes the connection after the first line
+  client.write((const uint8_t *)response, length);
+}
+
+void batchProgress(const Event &event)
+{
+  if (event.type != EVENT_BATCH_STEP && event.type != EVENT_IR_SENT)
+  {
+    return;
+  }
+  for (BatchStream &stream : streams)
+  {
+    if (!stream.open || stream.id != event.value)
+    {
+      continue;
+    }
+    if (event.type == EVENT_IR_SENT)
+    {
+      streamDone(stream);
+      continue;
+    }
+    char line[64];
+    int length = snprintf(line, sizeof(line), "{\"step\":%u,\"of\":%u,\"ms\":%lu}\n", event.step, stream.steps,
+                          (unsigned long)((esp_timer_get_time() - stream.startMicros) / 1000));
+    streamLine(stream, line, length);
+  }
+}
@@ -0,0 +1,35 @@
+/*
+ *  batch.h
+ *
+ *  Batches: many IR steps in one request, POST /batch with the steps in the body, separated by
+ *  commas, spaces or newlines:
+ *
+ *    <Key>          press a key, names as in keyNames[] ("Power", "VolumeUp", "7", ...) or the code database
+ *    channel:<n>    tune channel 0..999 with the channel macro
+ *    fave:<n>       go to favorite 0..9
+ *    wait:<ms>      pause, up to 65535 ms
+ *
+ *  The whole list is checked before anything is sent and then queued as a single IR command,
+ *  so nothing else goes out between its steps. The response stays open and gets one JSON line
+ *  per step as it is done, then a last line when the batch has finished.
+ */
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <WiFi.h>
+
+#include "events.h"
+#include "irTask.h"
+
+// Parses text into batch. On failure returns false, points error at a message and sets
+// failedStep to the index of the offending step.
+bool batchParse(const char *text, IrBatch &batch, size_t *failedStep, const char **error);
+
+// Keeps a copy of client to report the progress of batch command id, see batchProgress()
+void batchStreamStart(WiFiClient &client, uint32_t id, uint8_t steps);
+
+// Called with the EVENT_BATCH_STEP and EVENT_IR_SENT events, writes the matching progress line
+// and closes the stream once the batch is done
+void batchProgress(const Event &event);
+
+#endif // BATCH_H
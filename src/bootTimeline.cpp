@@ -0,0 +1,76 @@
+#include "bootTimeline.h"
+
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "logger.h"
+#include "metrics.h"
+
+static const char *phaseNames[BOOT_PHASES] = {"setup",           "irReady",      "apUp",
+                                              "serverListening", "firstRequest", "firstIrSend"};
+
+// 64 bit like esp_timer_get_time(), a phase first reached after 71 minutes of idling would wrap in 32
+static std::atomic<int64_t> phaseMicros[BOOT_PHASES];
+
+void bootMark(BootPhase phase)
+{
+  if (phaseMicros[phase].load(std::memory_order_relaxed) != 0)
+  {
+    return;
+  }
+  int64_t expected = 0;
+  int64_t now = esp_timer_get_time();
+  if (phaseMicros[phase].compare_exchange_strong(expected, now != 0 ? now : 1))
+  {
+    if (now <= UINT32_MAX)
+    {
+      logWriteText(LOG_LEVEL_INFO, "Boot: %s after %u us", phaseNames[phase], (uint32_t)now);
+    }
+    else
+    {
+      logWriteText(LOG_LEVEL_INFO, "Boot: %s after %u s", phaseNames[phase], (uint32_t)(now / 1000000));
+    }
+  }
+}
+
+int64_t bootMicros(BootPhase phase)
+{
+  return phaseMicros[phase];
+}
+
+void bootWriteJson(Print &out)
+{
+  out.print("{");
+  for (int phase = 0; phase < BOOT_PHASES; phase++)
+  {
+    out.print(phase == 0 ? "\"" : ",\"");
+    out.print(phaseNames[phase]);
+    out.print("\":");
+    int64_t micros = phaseMicros[phase];
+    if (micros != 0)
+    {
+      out.print((long long)micros);
+    }
+    else
+    {
+      out.print("null");
+    }
+  }
+  out.println("}");
+}
+
+void bootWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_boot_phase_seconds", "gauge", "Time from power-on until each boot phase was reached.");
+  for (int phase = 0; phase < BOOT_PHASES; phase++)
+  {
+    int64_t micros = phaseMicros[phase];
+    if (micros != 0)
+    {
+      char labels[32];
+      snprintf(labels, sizeof(labels), "phase=\"%s\"", phaseNames[phase]);
+      metricsWriteSeconds(out, "sirius_boot_phase_seconds", labels, micros);
+    }
+  }
+}
@@ -0,0 +1,30 @@
+/*
+ *  bootTimeline.h
+ *
+ *  Microseconds since power-on (esp_timer_get_time()) at which each boot phase was first reached,
+ *  logged as it happens and served as JSON by /boot and as gauges by /metrics. Phases are marked
+ *  from whichever task reaches them, the access point and the IR side start in parallel.
+ */
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+
+enum BootPhase : uint8_t
+{
+  BOOT_SETUP,            // setup() entered
+  BOOT_IR_READY,         // IR task and scheduler running, stored mode resumed
+  BOOT_AP_UP,            // Soft AP has its address
+  BOOT_SERVER_LISTENING, // HTTP server accepts connections
+  BOOT_FIRST_REQUEST,    // First request answered
+  BOOT_FIRST_IR_SEND,    // First IR command on the air, the resumed jump if there is one
+  BOOT_PHASES
+};
+
+void bootMark(BootPhase phase); // Records the phase the first time it is reached, later calls do nothing
+int64_t bootMicros(BootPhase phase); // 0 if not reached yet
+
+void bootWriteJson(Print &out);    // {"setup":<us>,...}, null for phases not reached yet
+void bootWriteMetrics(Print &out); // Reached phases for /metrics
+
+#endif // BOOT_TIMELINE_H
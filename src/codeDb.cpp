@@ -0,0 +1,128 @@
+#include "codeDb.h"
+
+#include <esp_partition.h>
+#include <esp_timer.h>
+
+#include "perfectHash.h"
+
+static const CodeDbHeader *header = NULL;
+static const CodeDbEntry *entries = NULL;
+static const uint8_t *slots = NULL;
+
+static uint32_t fnv1a(const uint8_t *data, size_t length)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static const char *check(const CodeDbHeader *candidate, size_t size)
+{
+  if (memcmp(candidate->magic, "IRDB", 4) != 0)
+  {
+    return "no code database";
+  }
+  if (candidate->version != CODE_DB_VERSION || candidate->headerSize < sizeof(CodeDbHeader))
+  {
+    return "unknown version";
+  }
+  size_t records = candidate->headerSize + candidate->codeCount * sizeof(CodeDbEntry);
+  if (candidate->totalSize > size || records + candidate->hashSlots != candidate->totalSize ||
+      candidate->codeCount >= CODE_DB_EMPTY_SLOT || (candidate->hashSlots & (candidate->hashSlots - 1)) != 0 ||
+      candidate->hashSlots < candidate->codeCount || memchr(candidate->profile, 0, sizeof(candidate->profile)) == NULL)
+  {
+    return "bad header";
+  }
+  const uint8_t *bytes = (const uint8_t *)candidate;
+  if (fnv1a(bytes + candidate->headerSize, candidate->totalSize - candidate->headerSize) != candidate->checksum)
+  {
+    return "bad checksum";
+  }
+  // Lookups and the key list trust nameLength to stay inside the name field
+  const CodeDbEntry *codes = (const CodeDbEntry *)(bytes + candidate->headerSize);
+  for (size_t i = 0; i < candidate->codeCount; i++)
+  {
+    if (codes[i].nameLength > CODE_DB_MAX_NAME)
+    {
+      return "bad entry";
+    }
+  }
+  return NULL;
+}
+
+bool codeDbBegin()
+{
+  int64_t start = esp_timer_get_time();
+  const esp_partition_t *partition =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)CODE_DB_SUBTYPE, CODE_DB_PARTITION);
+  if (partition == NULL)
+  {
+    Serial.println("Code database: no partition, using the built-in codes");
+    return false;
+  }
+  const void *data;
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &data, &handle) != ESP_OK)
+  {
+    Serial.println("Code database: mapping failed, using the built-in codes");
+    return false;
+  }
+  const CodeDbHeader *candidate = (const CodeDbHeader *)data;
+  const char *error = partition->size < sizeof(CodeDbHeader) ? "no code database" : check(candidate, partition->size);
+  if (error != NULL)
+  {
+    spi_flash_munmap(handle);
+    Serial.printf("Code database: %s, using the built-in codes\n", error);
+    return false;
+  }
+  // The mapping stays for as long as the firmware runs
+  const uint8_t *bytes = (const uint8_t *)data;
+  entries = (const CodeDbEntry *)(bytes + candidate->headerSize);
+  slots = bytes + candidate->headerSize + candidate->codeCount * sizeof(CodeDbEntry);
+  header = candidate;
+  Serial.printf("Code database: profile %s, %u codes, mapped in %lu us\n", header->profile,
+                header->codeCount, (unsigned long)(esp_timer_get_time() - start));
+  return true;
+}
+
+uint32_t codeDbNec(Key key)
+{
+  if (header != NULL && key < header->codeCount && entries[key].protocol == CODE_DB_PROTOCOL_NEC)
+  {
+    return entries[key].code;
+  }
+  return keyCodes[key];
+}
+
+int codeDbFind(const char *name, size_t length)
+{
+  if (header == NULL || length > CODE_DB_MAX_NAME)
+  {
+    return -1;
+  }
+  uint8_t index = slots[perfectHashOf(name, length, header->hashSeed) & (header->hashSlots - 1)];
+  if (index >= header->codeCount || entries[index].nameLength != length ||
+      memcmp(entries[index].name, name, length) != 0)
+  {
+    return -1;
+  }
+  return index;
+}
+
+size_t codeDbCount()
+{
+  return header != NULL ? header->codeCount : 0;
+}
+
+const CodeDbEntry *codeDbEntry(size_t index)
+{
+  return index < codeDbCount() ? &entries[index] : NULL;
+}
+
+const char *codeDbProfile()
+{
+  return header != NULL ? header->profile : "built-in";
+}
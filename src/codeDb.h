@@ -0,0 +1,68 @@
+/*
+ *  codeDb.h
+ *
+ *  Codes of the remote from the "codedb" flash partition, so another remote or a fixed code is
+ *  a flash of that partition with tools/codeDb.py's output instead of a new firmware.
+ *
+ *  The partition is mapped into the address space and used where it is: nothing is parsed or
+ *  copied at boot, only the header and a checksum are checked. Record n is function n of the
+ *  remote, the same as Key n, so a key's code is one indexed read. Records past KEY_COUNT are
+ *  codes the firmware has no Key for, they are reached by name through the perfect hash the
+ *  converter stored behind the records (same hash as perfectHash.h). Without a valid partition
+ *  the codes compiled from codes.h are used.
+ *
+ *  Format version 1, little endian:
+ *    CodeDbHeader
+ *    CodeDbEntry[codeCount]      at headerSize
+ *    uint8_t slots[hashSlots]    record index per hash slot, CODE_DB_EMPTY_SLOT if none
+ *  checksum is FNV-1a over everything after the header up to totalSize.
+ */
+#ifndef CODE_DB_H
+#define CODE_DB_H
+
+#include <Arduino.h>
+
+#include "codes.h"
+
+#define CODE_DB_PARTITION "codedb"
+#define CODE_DB_SUBTYPE 0x40 // First custom data subtype, see partitions.csv
+#define CODE_DB_VERSION 1
+#define CODE_DB_MAX_NAME 15
+#define CODE_DB_PROTOCOL_NEC 1
+#define CODE_DB_EMPTY_SLOT 0xFF
+
+struct CodeDbHeader
+{
+  char magic[4]; // "IRDB"
+  uint16_t version;
+  uint16_t headerSize; // Offset of the first record, later versions may add fields
+  uint16_t codeCount;
+  uint16_t hashSlots; // Power of two
+  uint32_t hashSeed;
+  uint32_t totalSize;
+  uint32_t checksum;
+  char profile[16]; // Zero terminated, e.g. "Sirius"
+  uint8_t reserved[8];
+};
+
+struct CodeDbEntry
+{
+  char name[16]; // nameLength characters, zero padded
+  uint8_t protocol;
+  uint8_t nameLength;
+  uint16_t reserved;
+  uint32_t code; // For sendNECRaw()
+};
+
+static_assert(sizeof(CodeDbHeader) == 48 && sizeof(CodeDbEntry) == 24, "Layout of tools/codeDb.py");
+
+// Maps and checks the partition. Returns false, and the compiled codes are used, if there is none or it is invalid.
+bool codeDbBegin();
+
+uint32_t codeDbNec(Key key); // Code of the key, from the partition if it has one for it
+int codeDbFind(const char *name, size_t length); // Record with that name, -1 if there is none
+size_t codeDbCount(); // Records in the partition, 0 without one
+const CodeDbEntry *codeDbEntry(size_t index);
+const char *codeDbProfile(); // "built-in" without a partition
+
+#endif // CODE_DB_H
@@ -0,0 +1,30 @@
+#include "events.h"
+
+static QueueHandle_t eventQueue = NULL;
+
+void eventsBegin()
+{
+  eventQueue = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(Event));
+}
+
+bool eventPost(EventType type, uint32_t value, uint16_t step)
+{
+  // Posted before eventsBegin() means nobody can be listening yet
+  if (eventQueue == NULL)
+  {
+    return false;
+  }
+  Event event = {type, step, value};
+  return xQueueSend(eventQueue, &event, 0) == pdTRUE;
+}
+
+bool eventReceive(Event &event)
+{
+  return eventQueue != NULL && xQueueReceive(eventQueue, &event, 0) == pdTRUE;
+}
+
+bool eventWait(TickType_t ticks)
+{
+  Event event;
+  return eventQueue != NULL && xQueuePeek(eventQueue, &event, ticks) == pdTRUE;
+}
@@ -0,0 +1,42 @@
+/*
+ *  events.h
+ *
+ *  What happened on the device, for pushing it to the WebSocket clients. Any task posts small
+ *  events into a FreeRTOS queue without blocking, loop() drains it and broadcasts them, so the
+ *  IR and scheduler tasks never wait on a slow phone.
+ */
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <Arduino.h>
+
+#define EVENT_QUEUE_LENGTH 16
+
+enum EventType : uint8_t
+{
+  EVENT_STATE,        // Mode, favorite or delay changed
+  EVENT_JOB_FIRED,    // value is the id of the scheduled job that fell due
+  EVENT_IR_SENT,      // value is the id of the IR command that is now on the air
+  EVENT_BATCH_STEP,   // value is the id of a batch command, step the index of the step that is done
+  EVENT_IR_COALESCED  // value is the id of an IR command a newer one replaced before it was sent
+};
+
+struct Event
+{
+  EventType type;
+  uint16_t step;
+  uint32_t value;
+};
+
+void eventsBegin();
+
+// Never blocks, an event is dropped if the queue is full. False if it was dropped.
+bool eventPost(EventType type, uint32_t value = 0, uint16_t step = 0);
+
+// Takes the oldest event, false if there is none.
+bool eventReceive(Event &event);
+
+// Blocks until an event is waiting or ticks have passed, without taking it. True if one is waiting.
+bool eventWait(TickType_t ticks);
+
+#endif // EVENTS_H
@@ -0,0 +1,323 @@
+#include "httpParser.h"
+
+#include <limits.h>
+#include <string.h>
+#include <strings.h>
+
+enum HttpParseState : uint8_t
+{
+  STATE_REQUEST_LINE,
+  STATE_HEADERS,
+  STATE_BODY,
+  STATE_DONE,
+  STATE_ERROR
+};
+
+void httpRequestReset(HttpRequest &request)
+{
+  request.method = "";
+  request.path = "";
+  request.query = "";
+  request.ifNoneMatch[0] = '\0';
+  request.acceptsGzip = false;
+  request.upgradeWebSocket = false;
+  request.webSocketKey[0] = '\0';
+  request.body[0] = '\0';
+  request.bodyLength = 0;
+  request.contentLength = 0;
+  request.line[0] = '\0';
+  request.lineLength = 0;
+  request.headerBytes = 0;
+  request.state = STATE_REQUEST_LINE;
+}
+
+// Splits "METHOD /path?query HTTP/1.x" in place.
+static bool splitRequestLine(HttpRequest &request)
+{
+  char *method = request.line;
+  char *target = strchr(method, ' ');
+  if (target == nullptr)
+  {
+    return false;
+  }
+  *target++ = '\0';
+  char *version = strchr(target, ' ');
+  if (version == nullptr || strncmp(version + 1, "HTTP/", 5) != 0 || *target != '/')
+  {
+    return false;
+  }
+  *version = '\0';
+
+  char *query = strchr(target, '?');
+  if (query != nullptr)
+  {
+    *query++ = '\0';
+  }
+  request.method = method;
+  request.path = target;
+  request.query = query != nullptr ? query : "";
+  return *method != '\0';
+}
+
+// Value of a "Name: value" line if it has that name, otherwise nullptr
+static const char *headerValue(const char *header, const char *name)
+{
+  size_t length = strlen(name);
+  if (strncasecmp(header, name, length) != 0 || header[length] != ':')
+  {
+    return nullptr;
+  }
+  header += length + 1;
+  while (*header == ' ' || *header == '\t')
+  {
+    header++;
+  }
+  return header;
+}
+
+// Content-Length, larger than HTTP_MAX_BODY if it is not a plain number
+static uint16_t parseContentLength(const char *value)
+{
+  uint32_t length = 0;
+  for (; *value >= '0' && *value <= '9'; value++)
+  {
+    length = length * 10 + (*value - '0');
+    if (length > HTTP_MAX_BODY)
+    {
+      return HTTP_MAX_BODY + 1;
+    }
+  }
+  return *value == '\0' || *value == ' ' ? length : HTTP_MAX_BODY + 1;
+}
+
+static void keepHeader(HttpRequest &request)
+{
+  size_t length = request.lineLength < HTTP_MAX_HEADER_LINE ? request.lineLength : HTTP_MAX_HEADER_LINE - 1;
+  request.header[length] = '\0';
+  const char *value;
+  if ((value = headerValue(request.header, "If-None-Match")) != nullptr)
+  {
+    // A truncated line would give a wrong tag, better none
+    if (request.lineLength < HTTP_MAX_HEADER_LINE && strlen(value) < HTTP_MAX_ETAG)
+    {
+      strcpy(request.ifNoneMatch, value);
+    }
+  }
+  else if ((value = headerValue(request.header, "Accept-Encoding")) != nullptr)
+  {
+    request.acceptsGzip = strstr(value, "gzip") != nullptr;
+  }
+  else if ((value = headerValue(request.header, "Content-Length")) != nullptr)
+  {
+    request.contentLength = parseContentLength(value);
+  }
+  else if ((value = headerValue(request.header, "Upgrade")) != nullptr)
+  {
+    request.upgradeWebSocket = strcasecmp(value, "websocket") == 0;
+  }
+  else if ((value = headerValue(request.header, "Sec-WebSocket-Key")) != nullptr)
+  {
+    if (request.lineLength < HTTP_MAX_HEADER_LINE && strlen(value) < HTTP_MAX_WEBSOCKET_KEY)
+    {
+      strcpy(request.webSocketKey, value);
+    }
+  }
+}
+
+HttpParseResult httpParse(HttpRequest &request, const char *data, size_t length, size_t *used)
+{
+  HttpParseResult result = HTTP_PARSE_MORE;
+  size_t i = 0;
+  while (i < length && result == HTTP_PARSE_MORE)
+  {
+    char c = data[i++];
+    switch (request.state)
+    {
+    case STATE_REQUEST_LINE:
+      if (c == '\n')
+      {
+        request.line[request.lineLength] = '\0';
+        request.lineLength = 0;
+        if (splitRequestLine(request))
+        {
+          request.state = STATE_HEADERS;
+        }
+        else
+        {
+          request.state = STATE_ERROR;
+          result = HTTP_PARSE_BAD_REQUEST;
+        }
+      }
+      else if (c != '\r')
+      {
+        if (request.lineLength + 1 >= HTTP_MAX_REQUEST_LINE)
+        {
+          request.state = STATE_ERROR;
+          result = HTTP_PARSE_URI_TOO_LONG;
+        }
+        else
+        {
+          request.line[request.lineLength++] = c;
+        }
+      }
+      break;
+
+    case STATE_HEADERS:
+      if (++request.headerBytes > HTTP_MAX_HEADER_BYTES)
+      {
+        request.state = STATE_ERROR;
+        result = HTTP_PARSE_HEADERS_TOO_LARGE;
+      }
+      else if (c == '\n')
+      {
+        // An empty line ends the header block
+        if (request.lineLength == 0 && request.contentLength > HTTP_MAX_BODY)
+        {
+          request.state = STATE_ERROR;
+          result = HTTP_PARSE_BODY_TOO_LARGE;
+        }
+        else if (request.lineLength == 0 && request.contentLength > 0)
+        {
+          request.state = STATE_BODY;
+        }
+        else if (request.lineLength == 0)
+        {
+          request.state = STATE_DONE;
+          result = HTTP_PARSE_DONE;
+        }
+        else
+        {
+          keepHeader(request);
+        }
+        request.lineLength = 0;
+      }
+      else if (c != '\r')
+      {
+        if (request.lineLength < HTTP_MAX_HEADER_LINE - 1)
+        {
+          request.header[request.lineLength] = c;
+        }
+        request.lineLength++;
+      }
+      break;
+
+    case STATE_BODY:
+      request.body[request.bodyLength++] = c;
+      if (request.bodyLength == request.contentLength)
+      {
+        request.body[request.bodyLength] = '\0';
+        request.state = STATE_DONE;
+        result = HTTP_PARSE_DONE;
+      }
+      break;
+
+    case STATE_DONE:
+      i--; // Nothing more to parse, leave the byte to the caller
+      result = HTTP_PARSE_DONE;
+      break;
+
+    default:
+      result = HTTP_PARSE_BAD_REQUEST;
+      break;
+    }
+  }
+  if (used != nullptr)
+  {
+    *used = i;
+  }
+  return result;
+}
+
+bool httpQueryValue(const HttpRequest &request, const char *name, const char **value, size_t *length)
+{
+  size_t nameLength = strlen(name);
+  const char *param = request.query;
+  while (*param != '\0')
+  {
+    const char *end = strchr(param, '&');
+    if (end == nullptr)
+    {
+      end = param + strlen(param);
+    }
+    if ((size_t)(end - param) > nameLength && strncmp(param, name, nameLength) == 0 && param[nameLength] == '=')
+    {
+      *value = param + nameLength + 1;
+      *length = end - *value;
+      return true;
+    }
+    param = *end == '&' ? end + 1 : end;
+  }
+  return false;
+}
+
+bool httpQueryLong(const HttpRequest &request, const char *name, long *value)
+{
+  const char *text;
+  size_t length;
+  if (!httpQueryValue(request, name, &text, &length) || length == 0 || length > 10)
+  {
+    return false;
+  }
+  long number = 0;
+  bool negative = text[0] == '-';
+  for (size_t i = negative ? 1 : 0; i < length; i++)
+  {
+    if (text[i] < '0' || text[i] > '9')
+    {
+      return false;
+    }
+    // long is 32 bits on the ESP32, ten digits can overflow it
+    if (number > (LONG_MAX - (text[i] - '0')) / 10)
+    {
+      return false;
+    }
+    number = number * 10 + (text[i] - '0');
+  }
+  if (negative && length == 1)
+  {
+    return false;
+  }
+  *value = negative ? -number : number;
+  return true;
+}
+
+static int hexValue(char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  c |= 0x20;
+  return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+bool httpQueryText(const HttpRequest &request, const char *name, char *text, size_t textSize)
+{
+  const char *value;
+  size_t length;
+  if (!httpQueryValue(request, name, &value, &length))
+  {
+    return false;
+  }
+  size_t used = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    char c = value[i];
+    if (c == '+')
+    {
+      c = ' ';
+    }
+    else if (c == '%' && i + 2 < length && hexValue(value[i + 1]) >= 0 && hexValue(value[i + 2]) >= 0)
+    {
+      c = hexValue(value[i + 1]) << 4 | hexValue(value[i + 2]);
+      i += 2;
+    }
+    if (used + 1 >= textSize)
+    {
+      return false;
+    }
+    text[used++] = c;
+  }
+  text[used] = '\0';
+  return true;
+}
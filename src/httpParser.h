@@ -0,0 +1,71 @@
+/*
+ *  httpParser.h
+ *
+ *  Incremental HTTP request parser for the control server.
+ *
+ *  Bytes are fed as they arrive from the WiFiClient. The request line is kept in a fixed buffer
+ *  inside HttpRequest and split in place into method, path and query. Of the headers only the
+ *  ones the server acts on are kept (If-None-Match, gzip in Accept-Encoding, a WebSocket upgrade),
+ *  the rest are only counted. A body announced with Content-Length is read into HttpRequest too.
+ *  Nothing is allocated; a request line, header block or body larger than the limits below is
+ *  rejected instead of being buffered.
+ */
+#ifndef HTTP_PARSER_H
+#define HTTP_PARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HTTP_MAX_REQUEST_LINE 256  // "GET /path?query HTTP/1.1", longer requests get 414
+#define HTTP_MAX_HEADER_BYTES 2048 // All header lines together, more gets 431
+#define HTTP_MAX_HEADER_LINE 96    // Longer header lines are only looked at up to here
+#define HTTP_MAX_ETAG 48           // Longer If-None-Match values are ignored
+#define HTTP_MAX_WEBSOCKET_KEY 32  // Sec-WebSocket-Key is 24 chars, longer ones are ignored
+#define HTTP_MAX_BODY 512          // Larger bodies get 413
+
+enum HttpParseResult
+{
+  HTTP_PARSE_MORE,        // Request not complete yet, feed more bytes
+  HTTP_PARSE_DONE,        // Request line and headers received
+  HTTP_PARSE_BAD_REQUEST, // Malformed request line
+  HTTP_PARSE_URI_TOO_LONG,
+  HTTP_PARSE_HEADERS_TOO_LARGE,
+  HTTP_PARSE_BODY_TOO_LARGE
+};
+
+struct HttpRequest
+{
+  const char *method; // Valid after HTTP_PARSE_DONE, all point into line[]
+  const char *path;
+  const char *query; // Part after '?', "" if there is none
+  char ifNoneMatch[HTTP_MAX_ETAG]; // "" if there is none
+  bool acceptsGzip;
+  bool upgradeWebSocket; // "Upgrade: websocket"
+  char webSocketKey[HTTP_MAX_WEBSOCKET_KEY]; // "" if there is none
+  char body[HTTP_MAX_BODY + 1];              // Terminated, "" without Content-Length
+  uint16_t bodyLength;
+  uint16_t contentLength;
+
+  char line[HTTP_MAX_REQUEST_LINE];
+  char header[HTTP_MAX_HEADER_LINE]; // Start of the header line being received
+  uint16_t lineLength;
+  uint16_t headerBytes;
+  uint8_t state;
+};
+
+void httpRequestReset(HttpRequest &request);
+
+// Consumes bytes until the request is complete or rejected. If used is given it receives the
+// number of bytes consumed, anything after the body (a pipelined request) is left to the caller.
+HttpParseResult httpParse(HttpRequest &request, const char *data, size_t length, size_t *used = nullptr);
+
+// Finds name=value in the query string. value is not terminated, its length is returned in length.
+bool httpQueryValue(const HttpRequest &request, const char *name, const char **value, size_t *length);
+// Decimal value of name, false if it is missing, not a number or does not fit in a long.
+// value is only written on success, so it can hold a default.
+bool httpQueryLong(const HttpRequest &request, const char *name, long *value);
+
+// Copies the percent-decoded value into text. False if it is missing or does not fit.
+bool httpQueryText(const HttpRequest &request, const char *name, char *text, size_t textSize);
+
+#endif // HTTP_PARSER_H
@@ -0,0 +1,159 @@
+#include "httpServer.h"
+
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "metrics.h"
+
+struct HttpConnection
+{
+  WiFiClient client;
+  bool open; // Slot in use, client may still have been closed by the peer
+  HttpRequest request;
+  int64_t acceptedMicros;
+};
+
+static WiFiServer server(80, HTTP_MAX_CONNECTIONS);
+static HttpConnection connections[HTTP_MAX_CONNECTIONS];
+
+static std::atomic<uint32_t> accepted(0);
+static std::atomic<uint32_t> timedOut(0);
+static std::atomic<uint32_t> rejectedBusy(0);
+
+void httpServerBegin(uint16_t port)
+{
+  server.begin(port);
+  server.setNoDelay(true);
+}
+
+// Closes the connection, answering with status first if there is one
+static void finish(WiFiClient &client, const char *status)
+{
+  if (status != nullptr)
+  {
+    client.print("HTTP/1.1 ");
+    client.print(status);
+    client.print("\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+  }
+  client.stop();
+}
+
+static void finish(HttpConnection &connection, const char *status)
+{
+  finish(connection.client, status);
+  connection.open = false;
+}
+
+static HttpConnection *freeSlot()
+{
+  for (HttpConnection &connection : connections)
+  {
+    if (!connection.open)
+    {
+      return &connection;
+    }
+  }
+  return nullptr;
+}
+
+static bool acceptWaiting()
+{
+  bool worked = false;
+  while (server.hasClient())
+  {
+    WiFiClient client = server.available();
+    if (!client)
+    {
+      break;
+    }
+    worked = true;
+    HttpConnection *connection = freeSlot();
+    if (connection == nullptr)
+    {
+      rejectedBusy.fetch_add(1, std::memory_order_relaxed);
+      finish(client, "503 Service Unavailable");
+      continue;
+    }
+    accepted.fetch_add(1, std::memory_order_relaxed);
+    connection->client = client;
+    connection->open = true;
+    connection->acceptedMicros = esp_timer_get_time();
+    httpRequestReset(connection->request);
+  }
+  return worked;
+}
+
+// Reads at most one buffer per pass so a client sending a lot cannot starve the others
+static bool serve(HttpConnection &connection, HttpRequestHandler handler, int64_t now)
+{
+  if (!connection.client.connected())
+  {
+    finish(connection, nullptr); // Went away before the request was complete
+    return true;
+  }
+  if (now - connection.acceptedMicros > HTTP_REQUEST_TIMEOUT_MS * 1000LL)
+  {
+    timedOut.fetch_add(1, std::memory_order_relaxed);
+    finish(connection, "408 Request Timeout");
+    return true;
+  }
+  if (connection.client.available() <= 0)
+  {
+    return false;
+  }
+  char buffer[128];
+  int length = connection.client.read((uint8_t *)buffer, sizeof(buffer));
+  if (length <= 0)
+  {
+    return false;
+  }
+  HttpParseResult result = httpParse(connection.request, buffer, length);
+  if (result != HTTP_PARSE_MORE)
+  {
+    handler(connection.client, connection.request, result, connection.acceptedMicros);
+    finish(connection, nullptr);
+  }
+  return true;
+}
+
+bool httpServerPoll(HttpRequestHandler handler)
+{
+  bool worked = acceptWaiting();
+  int64_t now = esp_timer_get_time();
+  for (HttpConnection &connection : connections)
+  {
+    if (connection.open)
+    {
+      worked |= serve(connection, handler, now);
+    }
+  }
+  return worked;
+}
+
+size_t httpServerConnections()
+{
+  size_t count = 0;
+  for (HttpConnection &connection : connections)
+  {
+    if (connection.open)
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+void httpServerWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_http_connections", "gauge", "Open HTTP connections.");
+  metricsWriteSample(out, "sirius_http_connections", "", httpServerConnections());
+  metricsWriteFamily(out, "sirius_http_connections_accepted_total", "counter", "HTTP connections accepted.");
+  metricsWriteSample(out, "sirius_http_connections_accepted_total", "", accepted);
+  metricsWriteFamily(out, "sirius_http_request_timeouts_total", "counter",
+                     "Connections closed with 408 because the request was not complete in time.");
+  metricsWriteSample(out, "sirius_http_request_timeouts_total", "", timedOut);
+  metricsWriteFamily(out, "sirius_http_rejected_busy_total", "counter",
+                     "Connections answered with 503 because all slots were in use.");
+  metricsWriteSample(out, "sirius_http_rejected_busy_total", "", rejectedBusy);
+}
@@ -0,0 +1,40 @@
+/*
+ *  httpServer.h
+ *
+ *  Connection handling of the control server. One task serves up to HTTP_MAX_CONNECTIONS
+ *  connections at the same time: every pass accepts what is waiting, reads whatever arrived on
+ *  each connection without blocking and feeds it to that connection's parser, so a slow or idle
+ *  client only holds its own slot instead of the whole server.
+ *
+ *  Limits: a request must be complete HTTP_REQUEST_TIMEOUT_MS after its connection was
+ *  accepted, otherwise it gets 408. A connection arriving while all slots are busy gets 503 and
+ *  is closed at once. The HTTP slots, the WebSocket clients (webSocket.h) and the listening
+ *  socket together stay below the 16 sockets lwIP is built with.
+ */
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <WiFi.h>
+
+#include "httpParser.h"
+
+#define HTTP_MAX_CONNECTIONS 8
+#define HTTP_REQUEST_TIMEOUT_MS 3000
+#define HTTP_SERVER_CORE 0 // Next to the Wi-Fi and lwIP tasks, the IR task has the other core
+
+// Gets every request that is complete or was rejected by the parser, the connection is closed
+// after it returns unless the handler kept a copy of the client. acceptedMicros is the
+// esp_timer_get_time() of the accept.
+typedef void (*HttpRequestHandler)(WiFiClient &client, const HttpRequest &request, HttpParseResult result,
+                                   int64_t acceptedMicros);
+
+void httpServerBegin(uint16_t port);
+
+// One pass over the listening socket and all connections. Never blocks, returns false if there
+// was nothing to do so the caller can sleep.
+bool httpServerPoll(HttpRequestHandler handler);
+
+size_t httpServerConnections();
+void httpServerWriteMetrics(Print &out); // Open connections, timeouts and busy rejections for /metrics
+
+#endif // HTTP_SERVER_H
@@ -0,0 +1,945 @@
+#include "irTask.h"
+
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "bootTimeline.h"
+#include "codeDb.h"
+#include "events.h"
+#include "logger.h"
+#include "lowPower.h"
+#include "metrics.h"
+#include "planner.h"
+#include "scheduler.h"
+
+#if defined(IR_BACKEND_RMT)
+#include <driver/rmt.h>
+
+#include "rmtEncoder.h"
+#else
+#define DISABLE_CODE_FOR_RECEIVER // Disables restarting receiver after each send. Saves 450 bytes program memory and 269 bytes RAM if receiving functions are not used.
+#include <IRremote.hpp>
+#endif
+
+#include "pins.h" // Define macros for input and output pin etc.
+
+// One pin per emitter, -DIR_EMITTER_PINS="{4,18,19}" for three. Emitter 0 is the first pin.
+#ifndef IR_EMITTER_PINS
+#define IR_EMITTER_PINS {IR_SEND_PIN}
+#endif
+
+#define NUMBER_OF_REPEATS 3U
+#define REPEAT_PERIOD_MICROS 110000 // From the start of a frame or repeat burst to the start of the next burst
+#define NEC_FRAME_MICROS 67500 // Header and 32 bits on average, up to the stop bit
+
+struct PendingCommand
+{
+  IrCommand command;
+  IrPriority priority;
+  bool deferred;     // Counted once when a scheduled command first had to wait
+  int64_t dueMicros; // Of a scheduled command, 0 for others
+};
+
+// Commands waiting for the IR tasks in queue order, guarded by enqueueMutex like everything the
+// enqueuers and the IR tasks share below
+static PendingCommand pending[IR_QUEUE_LENGTH];
+static size_t pendingCount = 0;
+static uint8_t busyEmitters = 0;         // Emitters of the commands on the air
+static int64_t lastManualMicros = -(IR_SCHEDULED_QUIET_MS * 1000LL); // When the last manual or power command ended
+static SemaphoreHandle_t enqueueMutex = NULL;
+static std::atomic<uint32_t> lastQueued(0);
+static std::atomic<uint32_t> lastCompleted(0);
+static std::atomic<uint32_t> releasedThrough(0); // Holds with ids up to this one stop, see irRelease()
+
+// Filled by irEnqueueBatch() and freed by the IR task once the batch has run
+static IrBatch batches[IR_BATCH_SLOTS];
+static std::atomic<bool> batchUsed[IR_BATCH_SLOTS];
+
+// From handing a key to the backend until it is on the air, per key and over all keys
+static std::atomic<uint32_t> keySends[KEY_COUNT];
+static std::atomic<uint32_t> keySendMicros[KEY_COUNT];
+static std::atomic<uint32_t> keyAverageMicros[KEY_COUNT]; // Moving average over about 8 sends, for the planner
+static LatencyHistogram sendDuration;
+static std::atomic<uint32_t> holds(0);
+static std::atomic<uint32_t> holdRepeats(0);
+static std::atomic<uint32_t> emitterSends[IR_MAX_EMITTERS];
+static std::atomic<uint32_t> commandAverageMicros[IR_COMMAND_HOLD + 1]; // Per IrCommandType, to estimate the airtime coalescing saves
+static uint32_t coalesced[IR_PRIORITIES];
+static uint64_t coalescedMicros = 0;
+static uint32_t deferred = 0;
+
+#if defined(IR_BACKEND_RMT)
+// Emitter i sends on RMT channel i, every channel has its own pin and clocks its items out on its own
+static const uint8_t emitterPins[] = IR_EMITTER_PINS;
+#define IR_EMITTERS (sizeof(emitterPins) / sizeof(emitterPins[0]))
+static_assert(IR_EMITTERS <= IR_MAX_EMITTERS && IR_EMITTERS <= RMT_CHANNEL_MAX, "More emitters than RMT channels");
+#else
+#define IR_EMITTERS 1 // IRremote has a single send pin
+#endif
+
+// One IR task per emitter. Each runs one command at a time, commands on emitters that do not
+// overlap run on different lanes at the same time.
+struct IrLane
+{
+  TaskHandle_t task;
+  uint32_t runningId;         // Command on the air, 0 if none, guarded by enqueueMutex
+  IrCommand runningCommand;   // Valid while runningId is not 0
+  IrPriority runningPriority;
+  uint8_t runningEmitters;    // Reserved in busyEmitters while it runs
+  // Only the lane's own task uses the rest
+  uint8_t activeEmitters;     // Of the command or batch step being sent, resolved from IrCommand::emitters
+#if defined(IR_BACKEND_RMT)
+  uint8_t pendingEmitters;    // Channels written since the last waitSent()
+  // Codes from the code database that differ from the compiled ones and hold frames, encoded
+  // when sent. The lane waits for the send to finish before it encodes the next one.
+  RmtSequence<rmtNecItems(NUMBER_OF_REPEATS)> codeSequence;
+  RmtSequence<rmtNecItems(0)> frameSequence;
+#endif
+};
+
+static IrLane lanes[IR_EMITTERS];
+
+// The lane of the calling IR task, for the macro runner's callbacks that do not carry it
+static IrLane &currentLane()
+{
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  for (IrLane &lane : lanes)
+  {
+    if (lane.task == task)
+    {
+      return lane;
+    }
+  }
+  return lanes[0];
+}
+
+#if defined(IR_BACKEND_RMT)
+// Every key with its repeats as RMT items, built by the compiler and sent straight from flash
+static constexpr RmtNecTable<NUMBER_OF_REPEATS, KEY_COUNT> keySequences = rmtNecTable<NUMBER_OF_REPEATS>(keyCodes);
+
+static void backendBegin()
+{
+  for (uint8_t emitter = 0; emitter < IR_EMITTERS; emitter++)
+  {
+    Serial.printf("Emitter %u sends IR signals with RMT at pin %u\n", emitter, emitterPins[emitter]);
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)emitterPins[emitter], (rmt_channel_t)emitter);
+    config.clk_div = 80; // 1 us ticks
+    config.tx_config.carrier_en = true;
+    config.tx_config.carrier_freq_hz = 38000;
+    config.tx_config.carrier_duty_percent = 33;
+    config.tx_config.carrier_level = RMT_CARRIER_LEVEL_HIGH;
+    config.tx_config.idle_output_en = true;
+    config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+    rmt_config(&config);
+    rmt_driver_install((rmt_channel_t)emitter, 0, 0);
+  }
+}
+
+// Blocks the lane's task, not the CPU, until the peripheral has sent everything
+static void waitSent(IrLane &lane)
+{
+  for (uint8_t emitter = 0; emitter < IR_EMITTERS; emitter++)
+  {
+    if (lane.pendingEmitters & (1 << emitter))
+    {
+      rmt_wait_tx_done((rmt_channel_t)emitter, portMAX_DELAY);
+    }
+  }
+  lane.pendingEmitters = 0;
+}
+
+// Starts the items on every active emitter without waiting, so they all send at the same time.
+// The channels start one after another, a few microseconds apart.
+static void transmit(IrLane &lane, const uint32_t *items, size_t length)
+{
+  for (uint8_t emitter = 0; emitter < IR_EMITTERS; emitter++)
+  {
+    if (lane.activeEmitters & (1 << emitter))
+    {
+      rmt_write_items((rmt_channel_t)emitter, (const rmt_item32_t *)items, length, false);
+      lane.pendingEmitters |= 1 << emitter;
+    }
+  }
+}
+
+// key is -1 for codes without a Key
+static void backendSend(IrLane &lane, uint32_t code, int key)
+{
+  const RmtSequence<rmtNecItems(NUMBER_OF_REPEATS)> *sequence = &lane.codeSequence;
+  if (key >= 0 && keyCodes[key] == code)
+  {
+    sequence = &keySequences.keys[key];
+  }
+  else
+  {
+    lane.codeSequence = rmtNecEncode<NUMBER_OF_REPEATS>(code);
+  }
+  // The peripheral clocks the items out while the CPU serves the web page
+  transmit(lane, sequence->items, sequence->length);
+}
+
+static constexpr RmtSequence<2> repeatSequence = rmtNecRepeat();
+
+// Frame without repeats, the start of a hold
+static void backendFrame(IrLane &lane, uint32_t code)
+{
+  lane.frameSequence = rmtNecEncode<0>(code);
+  transmit(lane, lane.frameSequence.items, lane.frameSequence.length);
+}
+
+static void backendRepeat(IrLane &lane)
+{
+  transmit(lane, repeatSequence.items, repeatSequence.length);
+}
+#else
+static IRsend irsend;
+
+static void backendBegin()
+{
+  Serial.println(F("Using library version " VERSION_IRREMOTE));
+  Serial.println(F("Send IR signals at pin " STR(IR_SEND_PIN)));
+
+  IrSender.begin(4, ENABLE_LED_FEEDBACK, 2); // Start with IR_SEND_PIN as send pin and enable feedback LED at default feedback LED pin
+}
+
+static void waitSent(IrLane &lane)
+{
+}
+
+static void backendSend(IrLane &lane, uint32_t code, int key)
+{
+  if ((lane.activeEmitters & 1) == 0)
+  {
+    return;
+  }
+  // Fixed NEC timing, the frame is sent once followed by NUMBER_OF_REPEATS repeat bursts like sendPronto() did
+  irsend.sendNECRaw(code, NUMBER_OF_REPEATS);
+}
+
+// Frame without repeats, the start of a hold
+static void backendFrame(IrLane &lane, uint32_t code)
+{
+  if (lane.activeEmitters & 1)
+  {
+    irsend.sendNECRaw(code, 0);
+  }
+}
+
+static void backendRepeat(IrLane &lane)
+{
+  if (lane.activeEmitters & 1)
+  {
+    irsend.sendNECRepeat();
+  }
+}
+#endif
+
+// key is -1 for codes of the code database without a Key, they are not counted per key
+static void sendCode(IrLane &lane, uint32_t code, int key)
+{
+  int64_t start = esp_timer_get_time();
+  backendSend(lane, code, key);
+  waitSent(lane);
+  uint32_t micros = esp_timer_get_time() - start;
+  if (key >= 0)
+  {
+    keySends[key].fetch_add(1, std::memory_order_relaxed);
+    keySendMicros[key].fetch_add(micros, std::memory_order_relaxed);
+    uint32_t average = keyAverageMicros[key].load(std::memory_order_relaxed);
+    keyAverageMicros[key].store(average != 0 ? average - average / 8 + micros / 8 : micros, std::memory_order_relaxed);
+  }
+  sendDuration.observe(micros);
+  for (uint8_t emitter = 0; emitter < IR_EMITTERS; emitter++)
+  {
+    if (lane.activeEmitters & (1 << emitter))
+    {
+      emitterSends[emitter].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+static void sendKey(IrLane &lane, Key key)
+{
+  sendCode(lane, codeDbNec(key), key);
+}
+
+// One frame, then only repeat bursts for as long as the key is held, 11.8 ms of airtime per
+// 110 ms instead of a full frame per press. Stops early once irRelease() covers the id.
+static void hold(IrLane &lane, Key key, uint32_t millis, uint32_t id)
+{
+  int64_t start = esp_timer_get_time();
+  int64_t burstStart = start;
+  backendFrame(lane, codeDbNec(key));
+  holds.fetch_add(1, std::memory_order_relaxed);
+  while (burstStart + REPEAT_PERIOD_MICROS <= start + millis * 1000LL && releasedThrough < id)
+  {
+    waitSent(lane);
+    burstStart += REPEAT_PERIOD_MICROS;
+    int64_t left = burstStart - esp_timer_get_time();
+    if (left > 0)
+    {
+      delay((left + 500) / 1000);
+    }
+    backendRepeat(lane);
+    holdRepeats.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// Gaps of macros count from the end of the previous key, not from when it was handed to the backend
+static void wait(IrLane &lane, uint32_t millis)
+{
+  waitSent(lane);
+  delay(millis);
+}
+
+static void macroSendKey(Key key)
+{
+  sendKey(currentLane(), key);
+}
+
+static void macroWait(uint32_t millis)
+{
+  wait(currentLane(), millis);
+}
+
+static const MacroTarget irTarget = {macroSendKey, macroWait};
+
+// Runs the macro of that name, the built-in channel macro if "channel" was deleted
+static void runMacro(const char *name, uint16_t argument)
+{
+  Macro macro;
+  if (!macroGet(macroFind(name), macro))
+  {
+    const char *error;
+    if (strcmp(name, MACRO_CHANNEL_NAME) != 0 || !macroCompile(MACRO_CHANNEL_DEFAULT, macro, &error))
+    {
+      return;
+    }
+  }
+  macroRun(macro, argument, irTarget);
+}
+
+static void setFave(IrLane &lane, int fave)
+{
+  logWrite(LOG_LEVEL_INFO, "Fave %d", fave);
+  sendKey(lane, numberKeys[fave]);
+}
+
+static void runBatch(IrLane &lane, const IrCommand &command);
+
+static void run(IrLane &lane, const IrCommand &command)
+{
+  lane.activeEmitters = command.emitters != IR_ALL_EMITTERS ? command.emitters : (1 << IR_EMITTERS) - 1;
+  switch (command.type)
+  {
+  case IR_COMMAND_KEY:
+    if (command.value < KEY_COUNT)
+    {
+      sendKey(lane, (Key)command.value);
+    }
+    break;
+  case IR_COMMAND_CHANNEL:
+    if (command.value <= IR_MAX_CHANNEL)
+    {
+      logWrite(LOG_LEVEL_INFO, "Channel %u", command.value);
+      runMacro(MACRO_CHANNEL_NAME, command.value);
+    }
+    break;
+  case IR_COMMAND_FAVORITE:
+    if (command.value <= 9)
+    {
+      setFave(lane, command.value);
+    }
+    break;
+  case IR_COMMAND_POWER:
+    sendKey(lane, KEY_POWER);
+    break;
+  case IR_COMMAND_MACRO:
+  {
+    Macro macro;
+    if (macroGet(command.value, macro))
+    {
+      macroRun(macro, command.argument, irTarget);
+    }
+    break;
+  }
+  case IR_COMMAND_CODE:
+    if (command.value < KEY_COUNT)
+    {
+      sendKey(lane, (Key)command.value);
+    }
+    else if (command.value < codeDbCount() && codeDbEntry(command.value)->protocol == CODE_DB_PROTOCOL_NEC)
+    {
+      sendCode(lane, codeDbEntry(command.value)->code, -1);
+    }
+    break;
+  case IR_COMMAND_HOLD:
+    if (command.value < KEY_COUNT)
+    {
+      hold(lane, (Key)command.value,
+           command.argument < IR_MAX_HOLD_MILLIS ? command.argument : IR_MAX_HOLD_MILLIS, command.id);
+    }
+    break;
+  case IR_COMMAND_WAIT:
+    wait(lane, command.value);
+    break;
+  case IR_COMMAND_BATCH:
+    if (command.value < IR_BATCH_SLOTS)
+    {
+      runBatch(lane, command);
+    }
+    break;
+  }
+  plannerObserve(command);
+}
+
+static void runBatch(IrLane &lane, const IrCommand &command)
+{
+  const IrBatch &batch = batches[command.value];
+  for (uint8_t i = 0; i < batch.length; i++)
+  {
+    // Batches are built by irEnqueueBatch() callers, one inside another would never free its slot
+    if (batch.steps[i].type != IR_COMMAND_BATCH)
+    {
+      // Steps without emitters of their own go where the batch goes
+      IrCommand step = batch.steps[i];
+      if (step.emitters == IR_ALL_EMITTERS)
+      {
+        step.emitters = command.emitters;
+      }
+      run(lane, step);
+    }
+    waitSent(lane);
+    eventPost(EVENT_BATCH_STEP, command.id, i);
+  }
+  batchUsed[command.value] = false;
+}
+
+static uint8_t resolveEmitters(uint8_t emitters)
+{
+  return emitters != IR_ALL_EMITTERS ? emitters : (1 << IR_EMITTERS) - 1;
+}
+
+// Every emitter a command may send on, for a batch also the ones its steps name themselves
+static uint8_t commandEmitters(const IrCommand &command)
+{
+  uint8_t mask = resolveEmitters(command.emitters);
+  if (command.type == IR_COMMAND_BATCH && command.value < IR_BATCH_SLOTS)
+  {
+    const IrBatch &batch = batches[command.value];
+    for (uint8_t i = 0; i < batch.length; i++)
+    {
+      if (batch.steps[i].emitters != IR_ALL_EMITTERS)
+      {
+        mask |= batch.steps[i].emitters;
+      }
+    }
+  }
+  return mask;
+}
+
+// Call with enqueueMutex held. Everything below the oldest command still pending or on the air
+// is done, so lastCompleted only ever grows even though priorities reorder the queue.
+static void updateCompletedLocked()
+{
+  uint32_t oldest = lastQueued + 1;
+  for (const IrLane &lane : lanes)
+  {
+    if (lane.runningId != 0 && lane.runningId < oldest)
+    {
+      oldest = lane.runningId;
+    }
+  }
+  for (size_t i = 0; i < pendingCount; i++)
+  {
+    if (pending[i].command.id < oldest)
+    {
+      oldest = pending[i].command.id;
+    }
+  }
+  lastCompleted = oldest - 1;
+}
+
+static void removeLocked(size_t index)
+{
+  pendingCount--;
+  for (size_t i = index; i < pendingCount; i++)
+  {
+    pending[i] = pending[i + 1];
+  }
+}
+
+// Call with enqueueMutex held
+static size_t runningCountLocked()
+{
+  size_t count = 0;
+  for (const IrLane &lane : lanes)
+  {
+    count += lane.runningId != 0 ? 1 : 0;
+  }
+  return count;
+}
+
+// Takes the command lane sends next: the first one by priority, then queue order, whose emitters
+// are free. A command also waits behind every command before it in that order that shares an
+// emitter, so each emitter sends in the same order as with a single task. False if there is none,
+// wait is then how long until a deferred scheduled command may go or a new command arrives.
+static bool takeNext(IrLane &lane, PendingCommand &next, TickType_t &wait)
+{
+  bool found = false;
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  // Manual commands waiting or on the air count as the remote being used, like the last one sent
+  bool manual = false;
+  for (const IrLane &other : lanes)
+  {
+    manual = manual || (other.runningId != 0 && other.runningPriority != IR_PRIORITY_SCHEDULED);
+  }
+  for (size_t i = 0; i < pendingCount; i++)
+  {
+    manual = manual || pending[i].priority != IR_PRIORITY_SCHEDULED;
+  }
+  int64_t quietLeft = lastManualMicros + IR_SCHEDULED_QUIET_MS * 1000LL - esp_timer_get_time();
+  wait = portMAX_DELAY;
+  uint8_t blocked = busyEmitters;
+  for (int priority = IR_PRIORITIES - 1; priority >= 0 && !found; priority--)
+  {
+    for (size_t i = 0; i < pendingCount && !found; i++)
+    {
+      PendingCommand &entry = pending[i];
+      if (entry.priority != priority)
+      {
+        continue;
+      }
+      if (priority == IR_PRIORITY_SCHEDULED && (manual || quietLeft > 0))
+      {
+        if (!entry.deferred)
+        {
+          entry.deferred = true;
+          deferred++;
+        }
+        // Otherwise the lane that ends the last manual command wakes the others
+        if (!manual)
+        {
+          wait = pdMS_TO_TICKS(quietLeft / 1000) + 1;
+        }
+        continue;
+      }
+      uint8_t mask = commandEmitters(entry.command);
+      if (mask & blocked)
+      {
+        blocked |= mask;
+        continue;
+      }
+      if (runningCountLocked() == 0)
+      {
+        lowPowerIrBegin();
+      }
+      next = entry;
+      removeLocked(i);
+      lane.runningId = next.command.id;
+      lane.runningCommand = next.command;
+      lane.runningPriority = next.priority;
+      lane.runningEmitters = mask;
+      busyEmitters |= mask;
+      found = true;
+    }
+  }
+  xSemaphoreGive(enqueueMutex);
+  return found;
+}
+
+// Wakes every lane but the caller, to look at the queue again
+static void notifyLanes(const IrLane *except)
+{
+  for (IrLane &lane : lanes)
+  {
+    if (&lane != except && lane.task != NULL)
+    {
+      xTaskNotifyGive(lane.task);
+    }
+  }
+}
+
+static void irTask(void *parameter)
+{
+  IrLane &lane = *(IrLane *)parameter;
+  lane.task = xTaskGetCurrentTaskHandle();
+  PendingCommand next;
+  TickType_t wait;
+  while (1)
+  {
+    if (!takeNext(lane, next, wait))
+    {
+      // Woken for every new command and whenever another lane frees its emitters
+      ulTaskNotifyTake(pdTRUE, wait);
+      continue;
+    }
+    int64_t start = esp_timer_get_time();
+    if (next.dueMicros != 0)
+    {
+      schedulerObserveLateness(start - next.dueMicros);
+    }
+    run(lane, next.command);
+    waitSent(lane);
+    int64_t end = esp_timer_get_time();
+    uint32_t micros = end - start;
+    uint32_t average = commandAverageMicros[next.command.type].load(std::memory_order_relaxed);
+    commandAverageMicros[next.command.type].store(average != 0 ? average - average / 8 + micros / 8 : micros,
+                                                  std::memory_order_relaxed);
+    // With a resumed jump mode this is its first send, nothing else can be queued that early
+    bootMark(BOOT_FIRST_IR_SEND);
+    xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+    lane.runningId = 0;
+    busyEmitters &= ~lane.runningEmitters;
+    if (next.priority != IR_PRIORITY_SCHEDULED)
+    {
+      lastManualMicros = end;
+    }
+    if (runningCountLocked() == 0)
+    {
+      lowPowerIrEnd();
+    }
+    updateCompletedLocked();
+    xSemaphoreGive(enqueueMutex);
+    eventPost(EVENT_IR_SENT, next.command.id);
+    notifyLanes(&lane);
+  }
+}
+
+void irTaskStart()
+{
+  backendBegin();
+  macroBegin();
+  enqueueMutex = xSemaphoreCreateMutex();
+  for (uint8_t emitter = 0; emitter < IR_EMITTERS; emitter++)
+  {
+    char name[16];
+    snprintf(name, sizeof(name), "IR send %u", emitter);
+    xTaskCreatePinnedToCore(
+        irTask,          // Function that should be called
+        name,            // Name of the task (for debugging)
+        4096,            // Stack size (bytes)
+        &lanes[emitter], // Parameter to pass
+        2,               // Task priority, above the jump mode task
+        &lanes[emitter].task, // Task handle
+        IR_CORE          // Core, Wi-Fi interrupts on the other one cannot stretch the bit timing
+    );
+  }
+}
+
+// Commands that only decide which channel the receiver ends up on, a newer one makes them pointless
+static bool isTune(IrCommandType type)
+{
+  return type == IR_COMMAND_CHANNEL || type == IR_COMMAND_FAVORITE;
+}
+
+// Airtime of a command, what commands of its type took lately. Before a tune was ever sent, the
+// keys of the default channel macro (DirectTune and at least two digits, 400 ms apart) or the
+// favorite digit.
+static uint32_t estimateMicros(const IrCommand &command)
+{
+  uint32_t average = commandAverageMicros[command.type].load(std::memory_order_relaxed);
+  if (average != 0 || !isTune(command.type))
+  {
+    return average;
+  }
+  uint32_t keyMicros = NEC_FRAME_MICROS + NUMBER_OF_REPEATS * REPEAT_PERIOD_MICROS;
+  if (command.type == IR_COMMAND_FAVORITE)
+  {
+    return keyMicros;
+  }
+  uint32_t keys = command.value >= 100 ? 4 : 3;
+  return keys * keyMicros + (keys - 1) * 400000;
+}
+
+// Call with enqueueMutex held. Also true for a queued or running batch marked as a tune.
+static bool isTuneLocked(const IrCommand &command)
+{
+  return isTune(command.type) ||
+         (command.type == IR_COMMAND_BATCH && command.value < IR_BATCH_SLOTS && batches[command.value].tune);
+}
+
+// Whether a newer command makes a waiting one pointless: a tune replaces tunes of the same or a lower
+// priority on emitters it sends on too, a scheduled command replaces the same one still deferred
+// (a job that fell due again before its last send went out). tune tells whether command is one.
+static bool replaces(const IrCommand &command, bool tune, IrPriority priority, const PendingCommand &entry)
+{
+  if (tune && isTuneLocked(entry.command))
+  {
+    return entry.priority <= priority &&
+           (resolveEmitters(entry.command.emitters) & ~resolveEmitters(command.emitters)) == 0;
+  }
+  return priority == IR_PRIORITY_SCHEDULED && entry.priority == IR_PRIORITY_SCHEDULED &&
+         entry.command.type == command.type && entry.command.value == command.value &&
+         entry.command.argument == command.argument && entry.command.emitters == command.emitters;
+}
+
+// Call with enqueueMutex held. Drops the waiting commands command replaces, returns how many.
+// A scheduled command that replaces the same one takes over its due time if dueMicros is given,
+// the job has been late since then.
+static size_t coalesceLocked(const IrCommand &command, bool tune, IrPriority priority, uint32_t *ids,
+                             int64_t *dueMicros = NULL)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < pendingCount;)
+  {
+    const PendingCommand &entry = pending[i];
+    if (replaces(command, tune, priority, entry))
+    {
+      coalesced[entry.priority]++;
+      coalescedMicros += estimateMicros(entry.command);
+      ids[count++] = entry.command.id;
+      if (!tune && dueMicros != NULL && *dueMicros != 0 && entry.dueMicros != 0 && entry.dueMicros < *dueMicros)
+      {
+        *dueMicros = entry.dueMicros;
+      }
+      if (entry.command.type == IR_COMMAND_BATCH && entry.command.value < IR_BATCH_SLOTS)
+      {
+        batchUsed[entry.command.value] = false;
+      }
+      removeLocked(i);
+    }
+    else
+    {
+      i++;
+    }
+  }
+  if (count > 0)
+  {
+    updateCompletedLocked();
+  }
+  return count;
+}
+
+// Call with enqueueMutex held. Ids are handed out in queue order, see updateCompletedLocked().
+static uint32_t enqueueLocked(IrCommand &command, IrPriority priority, int64_t dueMicros = 0)
+{
+  if (pendingCount >= IR_QUEUE_LENGTH)
+  {
+    return 0;
+  }
+  command.id = lastQueued + 1;
+  pending[pendingCount++] = {command, priority, false, dueMicros};
+  lastQueued = command.id;
+  return command.id;
+}
+
+uint32_t irEnqueue(IrCommandType type, uint16_t value, uint16_t argument, uint8_t emitters, IrPriority priority,
+                   int64_t dueMicros)
+{
+  IrCommand command = {type, value, argument, 0, emitters};
+  if (type == IR_COMMAND_POWER ||
+      ((type == IR_COMMAND_KEY || type == IR_COMMAND_CODE || type == IR_COMMAND_HOLD) &&
+       (value == KEY_POWER || value == KEY_POWER_ON || value == KEY_POWER_OFF)))
+  {
+    priority = IR_PRIORITY_POWER;
+  }
+  uint32_t replaced[IR_QUEUE_LENGTH];
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  size_t replacedCount = coalesceLocked(command, isTune(type), priority, replaced, &dueMicros);
+  uint32_t id = enqueueLocked(command, priority, dueMicros);
+  xSemaphoreGive(enqueueMutex);
+  for (size_t i = 0; i < replacedCount; i++)
+  {
+    eventPost(EVENT_IR_COALESCED, replaced[i]);
+  }
+  if (id != 0)
+  {
+    notifyLanes(NULL);
+  }
+  if (id == 0)
+  {
+    logWrite(LOG_LEVEL_WARN, "IR queue full, command dropped");
+  }
+  return id;
+}
+
+uint32_t irEnqueueBatch(const IrBatch &batch, uint8_t emitters)
+{
+  uint32_t id = 0;
+  uint32_t replaced[IR_QUEUE_LENGTH];
+  size_t replacedCount = 0;
+  IrCommand command = {IR_COMMAND_BATCH, 0, 0, 0, emitters};
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  // A tune batch replaces waiting tunes, but only if it gets a slot, possibly one of theirs
+  bool slotFree = false;
+  for (uint16_t slot = 0; slot < IR_BATCH_SLOTS; slot++)
+  {
+    slotFree = slotFree || !batchUsed[slot];
+  }
+  for (size_t i = 0; i < pendingCount && batch.tune; i++)
+  {
+    slotFree = slotFree || (pending[i].command.type == IR_COMMAND_BATCH &&
+                            replaces(command, true, IR_PRIORITY_MANUAL, pending[i]));
+  }
+  if (batch.tune && slotFree)
+  {
+    replacedCount = coalesceLocked(command, true, IR_PRIORITY_MANUAL, replaced);
+  }
+  for (uint16_t slot = 0; slot < IR_BATCH_SLOTS; slot++)
+  {
+    if (!batchUsed[slot])
+    {
+      batches[slot] = batch;
+      command.value = slot;
+      id = enqueueLocked(command, IR_PRIORITY_MANUAL);
+      batchUsed[slot] = id != 0;
+      break;
+    }
+  }
+  xSemaphoreGive(enqueueMutex);
+  for (size_t i = 0; i < replacedCount; i++)
+  {
+    eventPost(EVENT_IR_COALESCED, replaced[i]);
+  }
+  if (id != 0)
+  {
+    notifyLanes(NULL);
+  }
+  return id;
+}
+
+void irRelease()
+{
+  releasedThrough = lastQueued.load();
+}
+
+uint32_t irKeySendMicros(Key key)
+{
+  return keyAverageMicros[key].load(std::memory_order_relaxed);
+}
+
+uint8_t irEmitterCount()
+{
+  return IR_EMITTERS;
+}
+
+uint32_t irQueueDepth()
+{
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  uint32_t depth = pendingCount;
+  xSemaphoreGive(enqueueMutex);
+  return depth;
+}
+
+uint32_t irLastQueued()
+{
+  return lastQueued;
+}
+
+uint32_t irLastCompleted()
+{
+  return lastCompleted;
+}
+
+uint32_t irCoalescedCount()
+{
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  uint32_t count = 0;
+  for (int priority = 0; priority < IR_PRIORITIES; priority++)
+  {
+    count += coalesced[priority];
+  }
+  xSemaphoreGive(enqueueMutex);
+  return count;
+}
+
+bool irTunePending(uint8_t emitters)
+{
+  uint8_t mask = resolveEmitters(emitters);
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  // A batch frees its slot just before it stops running, by then the planner has seen all its steps
+  bool found = false;
+  for (const IrLane &lane : lanes)
+  {
+    found = found || (lane.runningId != 0 && isTuneLocked(lane.runningCommand) &&
+                      (resolveEmitters(lane.runningCommand.emitters) & mask) != 0);
+  }
+  for (size_t i = 0; i < pendingCount && !found; i++)
+  {
+    found = isTuneLocked(pending[i].command) && (resolveEmitters(pending[i].command.emitters) & mask) != 0;
+  }
+  xSemaphoreGive(enqueueMutex);
+  return found;
+}
+
+uint32_t irDeferredCount()
+{
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  uint32_t count = deferred;
+  xSemaphoreGive(enqueueMutex);
+  return count;
+}
+
+uint32_t irStackHighWaterMark()
+{
+  uint32_t least = UINT32_MAX;
+  for (const IrLane &lane : lanes)
+  {
+    uint32_t mark = uxTaskGetStackHighWaterMark(lane.task);
+    least = mark < least ? mark : least;
+  }
+  return least;
+}
+
+void irWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_ir_queue_depth", "gauge", "IR commands waiting in the queue.");
+  metricsWriteSample(out, "sirius_ir_queue_depth", "", irQueueDepth());
+  metricsWriteFamily(out, "sirius_ir_commands_total", "counter", "IR commands queued.");
+  metricsWriteSample(out, "sirius_ir_commands_total", "", lastQueued);
+
+  static const char *priorityNames[IR_PRIORITIES] = {"scheduled", "manual", "power"};
+  xSemaphoreTake(enqueueMutex, portMAX_DELAY);
+  uint32_t coalescedCounts[IR_PRIORITIES];
+  memcpy(coalescedCounts, coalesced, sizeof(coalesced));
+  uint64_t savedMicros = coalescedMicros;
+  uint32_t deferredCount = deferred;
+  xSemaphoreGive(enqueueMutex);
+  metricsWriteFamily(out, "sirius_ir_coalesced_total", "counter",
+                     "Commands replaced by a newer one before they were sent, by priority.");
+  for (int priority = 0; priority < IR_PRIORITIES; priority++)
+  {
+    char labels[24];
+    snprintf(labels, sizeof(labels), "priority=\"%s\"", priorityNames[priority]);
+    metricsWriteSample(out, "sirius_ir_coalesced_total", labels, coalescedCounts[priority]);
+  }
+  metricsWriteFamily(out, "sirius_ir_coalesced_airtime_seconds_total", "counter",
+                     "Estimated airtime of the replaced commands, from what commands of their type took.");
+  metricsWriteSeconds(out, "sirius_ir_coalesced_airtime_seconds_total", "", savedMicros);
+  metricsWriteFamily(out, "sirius_ir_deferred_total", "counter",
+                     "Scheduled commands held back until the remote was idle.");
+  metricsWriteSample(out, "sirius_ir_deferred_total", "", deferredCount);
+
+  metricsWriteFamily(out, "sirius_ir_key_send_seconds", "summary", "Time to send a key with its repeats, per key.");
+  for (int key = 0; key < KEY_COUNT; key++)
+  {
+    uint32_t sends = keySends[key].load(std::memory_order_relaxed);
+    if (sends == 0)
+    {
+      continue;
+    }
+    char labels[32];
+    snprintf(labels, sizeof(labels), "key=\"%s\"", keyNames[key]);
+    metricsWriteSeconds(out, "sirius_ir_key_send_seconds_sum", labels,
+                        keySendMicros[key].load(std::memory_order_relaxed));
+    metricsWriteSample(out, "sirius_ir_key_send_seconds_count", labels, sends);
+  }
+
+  metricsWriteFamily(out, "sirius_ir_holds_total", "counter", "Keys held, sent as one frame and repeat bursts.");
+  metricsWriteSample(out, "sirius_ir_holds_total", "", holds);
+  metricsWriteFamily(out, "sirius_ir_hold_repeats_total", "counter", "Repeat bursts sent while keys were held.");
+  metricsWriteSample(out, "sirius_ir_hold_repeats_total", "", holdRepeats);
+
+  metricsWriteFamily(out, "sirius_ir_emitter_sends_total", "counter", "Keys and codes sent, per emitter.");
+  for (uint8_t emitter = 0; emitter < IR_EMITTERS; emitter++)
+  {
+    char labels[16];
+    snprintf(labels, sizeof(labels), "emitter=\"%u\"", emitter);
+    metricsWriteSample(out, "sirius_ir_emitter_sends_total", labels, emitterSends[emitter]);
+  }
+
+  metricsWriteFamily(out, "sirius_ir_send_duration_seconds", "histogram", "Time to send a key with its repeats.");
+  metricsWriteHistogram(out, "sirius_ir_send_duration_seconds", "", sendDuration);
+}
@@ -0,0 +1,108 @@
+/*
+ *  irTask.h
+ *
+ *  Single owner of the IR sender. Everybody else (HTTP handlers, the jump mode task) only queues
+ *  typed commands and returns. There is one IR task per emitter, each pin of its own. A command
+ *  goes out on one, some or all emitters at the same time and keeps them to itself until it is
+ *  done, so frames of different commands never interleave on an emitter, while commands for
+ *  emitters that do not overlap (a macro on emitter 0, a channel on emitter 1) go out together.
+ *
+ *  Airtime policy: a free IR task sends the pending command of the highest IrPriority first, in
+ *  queue order within a priority, that does not wait behind an earlier one for the same emitters,
+ *  and never interrupts a command on the air. A tune (a channel, a favorite or a batch marked as
+ *  one, like the planner's channel steps) replaces the tunes still waiting for the same emitters
+ *  at its own or a lower priority, so a burst of changes sends only the last one. Scheduled
+ *  commands wait while a manual command waits or is on the air and until IR_SCHEDULED_QUIET_MS
+ *  after the last one, so they do not land in the middle of digits typed one key at a time, and
+ *  a job falling due again while it waits is sent once.
+ */
+#ifndef IR_TASK_H
+#define IR_TASK_H
+
+#include <Arduino.h>
+
+#include "codes.h"
+#include "macro.h"
+
+#define IR_QUEUE_LENGTH 16
+#define IR_MAX_CHANNEL 999
+#define IR_CORE 1 // IR and scheduler tasks, away from Wi-Fi and the HTTP server on core 0
+#define IR_BATCH_MAX_STEPS 32
+#define IR_BATCH_SLOTS 2 // Batches queued or running at the same time
+#define IR_MAX_HOLD_MILLIS 10000 // Longest hold, in case the release never comes
+#define IR_MAX_EMITTERS 8 // Emitters are bits of a uint8_t mask, one RMT channel and IR task each
+#define IR_ALL_EMITTERS 0 // Mask that sends on every emitter
+#define IR_SCHEDULED_QUIET_MS 2000 // Scheduled commands wait this long after the last manual one
+
+enum IrCommandType : uint8_t
+{
+  IR_COMMAND_KEY,      // value is a Key
+  IR_COMMAND_CHANNEL,  // value is the channel number, tuned with the "channel" macro
+  IR_COMMAND_FAVORITE, // value is the favorite digit 0..9
+  IR_COMMAND_POWER,
+  IR_COMMAND_MACRO,    // value is the macro slot, argument is passed to its digits
+  IR_COMMAND_WAIT,     // value is milliseconds to keep the emitter idle
+  IR_COMMAND_BATCH,    // value is the batch slot, see irEnqueueBatch()
+  IR_COMMAND_CODE,     // value is a record of the code database, see codeDb.h
+  IR_COMMAND_HOLD      // value is a Key, argument how long it is held in milliseconds, see irRelease()
+};
+
+enum IrPriority : uint8_t
+{
+  IR_PRIORITY_SCHEDULED, // Scheduler jobs and the jump mode
+  IR_PRIORITY_MANUAL,    // The page, the HTTP API and WebSocket commands
+  IR_PRIORITY_POWER,     // Power commands and keys, whoever sends them
+  IR_PRIORITIES
+};
+
+struct IrCommand
+{
+  IrCommandType type;
+  uint16_t value;
+  uint16_t argument;
+  uint32_t id;
+  uint8_t emitters; // Bit i sends on emitter i, IR_ALL_EMITTERS for all of them
+};
+
+// Steps run back to back by the IR task, nothing else is sent in between
+struct IrBatch
+{
+  uint8_t length;
+  bool tune; // Steps only change the channel, so the batch is coalesced like IR_COMMAND_CHANNEL
+  IrCommand steps[IR_BATCH_MAX_STEPS]; // Key, channel, favorite, power or wait, ids are not used
+};
+
+void irTaskStart();
+
+// Queues a command without blocking. Returns its id, ids increase by one per command, or 0 if the queue is full.
+// A command replaced by a newer one before it was sent posts EVENT_IR_COALESCED instead of EVENT_IR_SENT.
+// dueMicros is the esp_timer_get_time() a scheduled command was due, the scheduler's lateness
+// histogram gets how much later it starts sending.
+uint32_t irEnqueue(IrCommandType type, uint16_t value = 0, uint16_t argument = 0,
+                   uint8_t emitters = IR_ALL_EMITTERS, IrPriority priority = IR_PRIORITY_MANUAL, int64_t dueMicros = 0);
+
+// Queues all steps as one manual command, only tune batches are replaced. After each step an EVENT_BATCH_STEP is posted with the id.
+// Steps with IR_ALL_EMITTERS are sent on the emitters of the batch.
+// Returns the id, or 0 if the queue or all batch slots are full.
+uint32_t irEnqueueBatch(const IrBatch &batch, uint8_t emitters = IR_ALL_EMITTERS);
+
+// Ends every hold queued so far after its current frame or repeat burst, holds queued later
+// are not affected. Skips the queue, so it takes effect while the hold is on the air.
+void irRelease();
+
+uint32_t irKeySendMicros(Key key); // Recent average time to send the key with its repeats, 0 if it was never sent
+
+// Emitters with a pin, the same RMT items go out on all of them at once. 1 with the IRremote backend.
+uint8_t irEmitterCount();
+
+uint32_t irQueueDepth();
+uint32_t irLastQueued();
+uint32_t irLastCompleted(); // A command is done, sent or replaced, once this is >= its id
+uint32_t irCoalescedCount(); // Commands replaced before they were sent
+bool irTunePending(uint8_t emitters); // A tune for any of the emitters is waiting or on the air
+uint32_t irDeferredCount();  // Scheduled commands that had to wait for the remote to be idle
+
+uint32_t irStackHighWaterMark(); // Bytes of stack the IR tasks never used, the least of them
+void irWriteMetrics(Print &out); // Queue, airtime policy, per key send counts, send durations and holds for /metrics
+
+#endif // IR_TASK_H
@@ -0,0 +1,209 @@
+#include "logger.h"
+
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "metrics.h"
+
+#define LOG_LINE 160
+
+struct LogRecord
+{
+  // First position of the round the slot is free for, that plus one once it holds the record of
+  // that round. A zeroed ring is empty, so records can be written before logBegin().
+  std::atomic<uint32_t> sequence;
+  LogLevel level;
+  int64_t micros;
+  const char *format;
+  uint32_t args[3];
+  char text[LOG_MAX_TEXT];
+};
+
+static LogRecord ring[LOG_RING_SIZE];
+static std::atomic<uint32_t> head(0); // Next position to claim
+static uint32_t tail = 0;             // Next position to print, drain task only
+static std::atomic<uint8_t> minLevel(LOG_LEVEL_INFO);
+static std::atomic<uint32_t> written(0);
+static std::atomic<uint32_t> dropped(0);
+static TaskHandle_t drainTaskHandle = NULL;
+
+static const char levelLetters[] = {'D', 'I', 'W', 'E'};
+
+// Claims a slot, NULL if the ring is full
+static LogRecord *claim(uint32_t &round)
+{
+  uint32_t position = head.load(std::memory_order_relaxed);
+  while (1)
+  {
+    LogRecord &record = ring[position % LOG_RING_SIZE];
+    round = position - position % LOG_RING_SIZE;
+    uint32_t sequence = record.sequence.load(std::memory_order_acquire);
+    if (sequence == round)
+    {
+      if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        return &record;
+      }
+    }
+    else if ((int32_t)(sequence - round) < 0)
+    {
+      return NULL; // Still holds the record of the previous round
+    }
+    else
+    {
+      position = head.load(std::memory_order_relaxed); // Another producer took it
+    }
+  }
+}
+
+static void append(LogLevel level, const char *format, const char *text, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+  if (level < minLevel.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  uint32_t round;
+  LogRecord *record = claim(round);
+  if (record == NULL)
+  {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  record->level = level;
+  record->micros = esp_timer_get_time();
+  record->format = format;
+  record->args[0] = a0;
+  record->args[1] = a1;
+  record->args[2] = a2;
+  size_t length = 0;
+  while (text != NULL && length < LOG_MAX_TEXT - 1 && text[length] != '\0')
+  {
+    record->text[length] = text[length];
+    length++;
+  }
+  record->text[length] = '\0';
+  record->sequence.store(round + 1, std::memory_order_release);
+  written.fetch_add(1, std::memory_order_relaxed);
+}
+
+void logWrite(LogLevel level, const char *format, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+  append(level, format, NULL, a0, a1, a2);
+}
+
+void logWriteText(LogLevel level, const char *format, const char *text, uint32_t a0, uint32_t a1)
+{
+  append(level, format, text, a0, a1, 0);
+}
+
+void logSetLevel(LogLevel level)
+{
+  minLevel = level;
+}
+
+size_t logFormat(char *line, size_t size, const char *format, const char *text, const uint32_t *args)
+{
+  size_t length = 0;
+  size_t arg = 0;
+  for (const char *c = format; *c != '\0' && length + 1 < size; c++)
+  {
+    int written = 0;
+    if (*c != '%' || c[1] == '\0')
+    {
+      line[length++] = *c;
+      continue;
+    }
+    c++;
+    size_t left = size - length;
+    uint32_t value = arg < 3 ? args[arg] : 0;
+    switch (*c)
+    {
+    case 'd':
+      written = snprintf(line + length, left, "%ld", (long)(int32_t)value);
+      arg++;
+      break;
+    case 'u':
+      written = snprintf(line + length, left, "%lu", (unsigned long)value);
+      arg++;
+      break;
+    case 'x':
+      written = snprintf(line + length, left, "%lx", (unsigned long)value);
+      arg++;
+      break;
+    case 's':
+      written = snprintf(line + length, left, "%s", text);
+      break;
+    default:
+      line[length++] = *c;
+      break;
+    }
+    length += written < (int)left ? written : left - 1;
+  }
+  line[length] = '\0';
+  return length;
+}
+
+// Prints one record, false if there is none
+static bool drainOne()
+{
+  LogRecord &record = ring[tail % LOG_RING_SIZE];
+  uint32_t round = tail - tail % LOG_RING_SIZE;
+  if (record.sequence.load(std::memory_order_acquire) != round + 1)
+  {
+    return false;
+  }
+  char line[LOG_LINE];
+  uint32_t seconds = record.micros / 1000000;
+  int length = snprintf(line, sizeof(line), "[%5lu.%06lu] %c ", (unsigned long)seconds,
+                        (unsigned long)(record.micros - seconds * 1000000LL), levelLetters[record.level]);
+  length += logFormat(line + length, sizeof(line) - length - 1, record.format, record.text, record.args);
+  // The slot is free again before the slow part
+  record.sequence.store(round + LOG_RING_SIZE, std::memory_order_release);
+  tail++;
+  line[length++] = '\n';
+  Serial.write((const uint8_t *)line, length);
+  return true;
+}
+
+static void drainTask(void *parameter)
+{
+  uint32_t droppedReported = 0;
+  while (1)
+  {
+    bool drained = false;
+    while (drainOne())
+    {
+      drained = true;
+    }
+    uint32_t droppedNow = dropped.load(std::memory_order_relaxed);
+    if (droppedNow != droppedReported)
+    {
+      Serial.printf("[log] %lu records dropped\n", (unsigned long)(droppedNow - droppedReported));
+      droppedReported = droppedNow;
+    }
+    // Polls slower while nothing is logged, so an idle unit is not woken 100 times a second
+    vTaskDelay(pdMS_TO_TICKS(drained ? LOG_POLL_MS : LOG_IDLE_POLL_MS));
+  }
+}
+
+void logBegin()
+{
+  xTaskCreatePinnedToCore(
+      drainTask,        // Function that should be called
+      "Log",            // Name of the task (for debugging)
+      3072,             // Stack size (bytes)
+      NULL,             // Parameter to pass
+      tskIDLE_PRIORITY, // Task priority, only runs when nothing else has to
+      &drainTaskHandle, // Task handle
+      LOG_CORE          // Core
+  );
+}
+
+void logWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_log_records_total", "counter", "Log records written to the ring buffer.");
+  metricsWriteSample(out, "sirius_log_records_total", "", written);
+  metricsWriteFamily(out, "sirius_log_dropped_total", "counter", "Log records dropped because the ring buffer was full.");
+  metricsWriteSample(out, "sirius_log_dropped_total", "", dropped);
+}
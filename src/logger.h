@@ -0,0 +1,45 @@
+/*
+ *  logger.h
+ *
+ *  Log records for Serial that cost the caller a slot in a ring buffer instead of a UART write.
+ *  logWrite() stores the format pointer, up to three numbers and a short copy of one string with a
+ *  timestamp, formatting happens later in a drain task of the lowest priority that writes the
+ *  lines out. Producers on any task claim slots with one compare-and-swap and never block: when
+ *  the ring is full the record is counted as dropped and the call returns.
+ *
+ *  Formats must be string literals or otherwise outlive the record. They take %d, %u, %x for the
+ *  numbers in order, %s for the text (cut to LOG_MAX_TEXT - 1 characters) and %%.
+ */
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+#define LOG_RING_SIZE 64     // Records, a power of two
+#define LOG_MAX_TEXT 32      // Bytes of the copied string, including the terminating zero
+#define LOG_CORE 0           // Drain task, away from the IR task
+#define LOG_POLL_MS 10       // Drain task period while records come in
+#define LOG_IDLE_POLL_MS 100 // Drain task period after a round that found none
+
+enum LogLevel : uint8_t
+{
+  LOG_LEVEL_DEBUG,
+  LOG_LEVEL_INFO,
+  LOG_LEVEL_WARN,
+  LOG_LEVEL_ERROR
+};
+
+// Starts the drain task, records written before are kept and printed then
+void logBegin();
+
+void logSetLevel(LogLevel level); // Records below it are skipped, LOG_LEVEL_INFO at start
+
+void logWrite(LogLevel level, const char *format, uint32_t a0 = 0, uint32_t a1 = 0, uint32_t a2 = 0);
+void logWriteText(LogLevel level, const char *format, const char *text, uint32_t a0 = 0, uint32_t a1 = 0);
+
+// Formats a record like the drain task does, returns the length without the terminating zero
+size_t logFormat(char *line, size_t size, const char *format, const char *text, const uint32_t *args);
+
+void logWriteMetrics(Print &out); // Records written and dropped for /metrics
+
+#endif // LOGGER_H
@@ -0,0 +1,139 @@
+#include "lowPower.h"
+
+#include <esp_pm.h>
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "events.h"
+#include "logger.h"
+#include "metrics.h"
+
+static bool managed = false; // esp_pm_configure() succeeded
+static esp_pm_lock_handle_t cpuLock = NULL;
+static esp_pm_lock_handle_t noSleepLock = NULL;
+
+// Server task only
+static bool busy = true; // Holds cpuLock, taken in lowPowerBegin()
+static int64_t stateSince = 0;
+static int64_t lastWork = 0;
+static TickType_t sleepTicks = 0; // Last sleep, 0 if the last pass did not sleep
+static int64_t sleptMicros = 0;   // How long it actually lasted
+static uint64_t busyMicros = 0;
+static uint64_t idleMicros = 0;
+static uint32_t wakeups = 0;
+static LatencyHistogram wakeDelay;
+
+// IR task, read by the server task
+static int64_t irStart = 0;
+static std::atomic<uint32_t> irMillis(0);
+
+void lowPowerBegin()
+{
+  esp_pm_config_esp32_t config = {LOW_POWER_MAX_FREQ_MHZ, LOW_POWER_MIN_FREQ_MHZ, true};
+  esp_err_t error = esp_pm_configure(&config);
+  managed = error == ESP_OK;
+  if (!managed)
+  {
+    logWrite(LOG_LEVEL_WARN, "Power management not available (%x), running at full speed", error);
+    return;
+  }
+  esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "server", &cpuLock);
+  esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "ir", &noSleepLock);
+  esp_pm_lock_acquire(cpuLock);
+  stateSince = esp_timer_get_time();
+  lastWork = stateSince;
+  logWrite(LOG_LEVEL_INFO, "Power management %u..%u MHz with light sleep", LOW_POWER_MIN_FREQ_MHZ,
+           LOW_POWER_MAX_FREQ_MHZ);
+}
+
+void lowPowerServerPass(bool worked)
+{
+  int64_t now = esp_timer_get_time();
+  if (worked)
+  {
+    if (sleepTicks > 0)
+    {
+      // The work may have arrived at any time during the sleep
+      wakeDelay.observe(sleptMicros);
+    }
+    if (!busy)
+    {
+      if (cpuLock != NULL)
+      {
+        esp_pm_lock_acquire(cpuLock);
+      }
+      idleMicros += now - stateSince;
+      stateSince = now;
+      busy = true;
+    }
+    lastWork = now;
+    sleepTicks = 0;
+    return;
+  }
+  if (busy && now - lastWork >= LOW_POWER_IDLE_AFTER_MS * 1000LL)
+  {
+    if (cpuLock != NULL)
+    {
+      esp_pm_lock_release(cpuLock);
+    }
+    busyMicros += now - stateSince;
+    stateSince = now;
+    busy = false;
+  }
+  // A tick like always while busy, longer and longer sleeps once idle
+  TickType_t maxTicks = pdMS_TO_TICKS(LOW_POWER_MAX_SLEEP_MS);
+  sleepTicks = busy || sleepTicks == 0 ? 1 : sleepTicks * 2 < maxTicks ? sleepTicks * 2 : maxTicks;
+  wakeups++;
+  eventWait(sleepTicks);
+  sleptMicros = esp_timer_get_time() - now;
+}
+
+void lowPowerIrBegin()
+{
+  if (noSleepLock != NULL)
+  {
+    esp_pm_lock_acquire(noSleepLock);
+  }
+  irStart = esp_timer_get_time();
+}
+
+void lowPowerIrEnd()
+{
+  irMillis.fetch_add((esp_timer_get_time() - irStart + 500) / 1000, std::memory_order_relaxed);
+  if (noSleepLock != NULL)
+  {
+    esp_pm_lock_release(noSleepLock);
+  }
+}
+
+void lowPowerWriteMetrics(Print &out)
+{
+  int64_t now = esp_timer_get_time();
+  uint64_t busyNow = busyMicros + (busy ? now - stateSince : 0);
+  uint64_t idleNow = idleMicros + (busy ? 0 : now - stateSince);
+  uint64_t irNow = irMillis.load(std::memory_order_relaxed) * 1000ULL;
+  uint64_t total = busyNow + idleNow;
+  // Microamp-seconds over seconds, the IR part comes on top of whatever the CPU did meanwhile
+  uint32_t milliamps = total == 0 ? 0
+                                  : (busyNow * LOW_POWER_BUSY_MA + idleNow * LOW_POWER_IDLE_MA + irNow * LOW_POWER_IR_MA) /
+                                        total;
+
+  metricsWriteFamily(out, "sirius_power_management_enabled", "gauge",
+                     "1 if the CPU clock scales down when idle, 0 if the framework lacks power management.");
+  metricsWriteSample(out, "sirius_power_management_enabled", "", managed ? 1 : 0);
+  metricsWriteFamily(out, "sirius_power_busy_seconds_total", "counter", "Time the server task held the CPU at full speed.");
+  metricsWriteSeconds(out, "sirius_power_busy_seconds_total", "", busyNow);
+  metricsWriteFamily(out, "sirius_power_idle_seconds_total", "counter", "Time the server task let the CPU scale down.");
+  metricsWriteSeconds(out, "sirius_power_idle_seconds_total", "", idleNow);
+  metricsWriteFamily(out, "sirius_power_ir_seconds_total", "counter", "Time the IR task kept the chip out of light sleep.");
+  metricsWriteSeconds(out, "sirius_power_ir_seconds_total", "", irNow);
+  metricsWriteFamily(out, "sirius_power_server_wakeups_total", "counter", "Sleeps of the server task between passes.");
+  metricsWriteSample(out, "sirius_power_server_wakeups_total", "", wakeups);
+  metricsWriteFamily(out, "sirius_power_wake_delay_seconds", "histogram",
+                     "Sleep before a server pass that found work, the most the work waited for the wake-up.");
+  metricsWriteHistogram(out, "sirius_power_wake_delay_seconds", "", wakeDelay);
+  metricsWriteFamily(out, "sirius_power_estimated_current_milliamps", "gauge",
+                     "Average supply current since boot estimated from busy, idle and IR time, see lowPower.h.");
+  metricsWriteSample(out, "sirius_power_estimated_current_milliamps", "", milliamps);
+}
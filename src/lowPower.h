@@ -0,0 +1,50 @@
+/*
+ *  lowPower.h
+ *
+ *  Idle power of a unit that sends a favorite every few minutes and otherwise waits for a phone.
+ *
+ *  Power management (esp_pm) runs the CPU at LOW_POWER_MAX_FREQ_MHZ only while a task holds the
+ *  CPU lock and drops to LOW_POWER_MIN_FREQ_MHZ otherwise, 80 MHz keeps the APB clock of the RMT
+ *  and Wi-Fi at full rate. Light sleep is enabled too and taken by the tickless idle of FreeRTOS
+ *  when the framework is built with CONFIG_FREERTOS_USE_TICKLESS_IDLE and nothing holds the
+ *  no-sleep lock, the IR task holds it while it sends. As long as the soft AP is up the Wi-Fi
+ *  driver keeps the chip out of light sleep, an access point has to beacon, and modem sleep is
+ *  only there for stations, so with the AP it is frequency scaling and fewer wake-ups that save.
+ *
+ *  The HTTP server task holds the CPU lock while it has work. After LOW_POWER_IDLE_AFTER_MS
+ *  without any it releases it and sleeps between passes, doubling the sleep up to
+ *  LOW_POWER_MAX_SLEEP_MS. Events of the IR and scheduler tasks wake it at once, a new connection
+ *  waits for the sleep to end, which is the latency idling adds (sirius_power_wake_delay_seconds).
+ *  The scheduler and IR tasks block until their next deadline or command anyway.
+ *
+ *  There is no current sensor. The average current is estimated from the time the server was busy
+ *  or idle and the time the IR task was sending, with LOW_POWER_*_MA ballparks of the ESP32
+ *  datasheet and an NEC emitter that a meter in the supply line should calibrate.
+ */
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#include <Arduino.h>
+
+#define LOW_POWER_MAX_FREQ_MHZ 240
+#define LOW_POWER_MIN_FREQ_MHZ 80
+#define LOW_POWER_IDLE_AFTER_MS 250 // Without work, then the server task starts to sleep
+#define LOW_POWER_MAX_SLEEP_MS 100  // Longest sleep of the server task, bounds the added latency
+
+#define LOW_POWER_BUSY_MA 130 // 240 MHz with the soft AP up
+#define LOW_POWER_IDLE_MA 95  // 80 MHz with the soft AP up
+#define LOW_POWER_IR_MA 40    // Added by the emitter LED over a whole key with its repeats
+
+void lowPowerBegin(); // Configures power management, without it in the framework everything runs at full speed
+
+// Server task, after each pass over its connections. Sleeps if the pass found nothing to do, until
+// the sleep is over or an event was posted.
+void lowPowerServerPass(bool worked);
+
+// IR tasks, from the first command on the air until none is: no light sleep while an emitter sends
+void lowPowerIrBegin();
+void lowPowerIrEnd();
+
+void lowPowerWriteMetrics(Print &out); // Busy and idle time, wake-ups, wake delay and estimated current for /metrics
+
+#endif // LOW_POWER_H
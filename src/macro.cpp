@@ -0,0 +1,421 @@
+#include "macro.h"
+
+#include <Preferences.h>
+
+#include "logger.h"
+
+static Macro slots[MACRO_SLOTS];
+static SemaphoreHandle_t slotsMutex = NULL;
+static Preferences preferences;
+
+// Parses the number after "prefix:" of a token, -1 if the token does not start with prefix
+static long tokenNumber(const char *token, size_t length, const char *prefix)
+{
+  size_t prefixLength = strlen(prefix);
+  if (length <= prefixLength + 1 || strncmp(token, prefix, prefixLength) != 0 || token[prefixLength] != ':')
+  {
+    return -1;
+  }
+  long number = 0;
+  for (size_t i = prefixLength + 1; i < length; i++)
+  {
+    if (token[i] < '0' || token[i] > '9' || number > 100000)
+    {
+      return -2;
+    }
+    number = number * 10 + (token[i] - '0');
+  }
+  return number;
+}
+
+bool macroCompile(const char *source, Macro &macro, const char **error)
+{
+  uint8_t length = 0;
+  uint8_t repeatCount[MACRO_MAX_DEPTH];
+  uint32_t repeatPresses[MACRO_MAX_DEPTH];
+  uint32_t repeatWaitMillis[MACRO_MAX_DEPTH];
+  uint32_t presses = 0; // Key presses and wait time of the current nesting level
+  uint32_t waitMillis = 0;
+  int depth = 0;
+
+  const char *token = source;
+  while (*token != '\0')
+  {
+    if (*token == ',' || *token == ' ')
+    {
+      token++;
+      continue;
+    }
+    size_t tokenLength = strcspn(token, ", ");
+    long number;
+    int key;
+    uint8_t op[3];
+    size_t opLength;
+
+    if (tokenLength == 3 && strncmp(token, "end", 3) == 0)
+    {
+      if (depth == 0)
+      {
+        *error = "end without repeat";
+        return false;
+      }
+      depth--;
+      presses = repeatPresses[depth] + presses * repeatCount[depth];
+      waitMillis = repeatWaitMillis[depth] + waitMillis * repeatCount[depth];
+      op[0] = MACRO_OP_END;
+      opLength = 1;
+    }
+    else if ((number = tokenNumber(token, tokenLength, "repeat")) != -1)
+    {
+      if (number < 1 || number > 255)
+      {
+        *error = "repeat count must be 1..255";
+        return false;
+      }
+      if (depth == MACRO_MAX_DEPTH)
+      {
+        *error = "repeats nested too deep";
+        return false;
+      }
+      repeatCount[depth] = number;
+      repeatPresses[depth] = presses;
+      repeatWaitMillis[depth] = waitMillis;
+      depth++;
+      presses = 0;
+      waitMillis = 0;
+      op[0] = MACRO_OP_REPEAT;
+      op[1] = number;
+      opLength = 2;
+    }
+    else if ((number = tokenNumber(token, tokenLength, "wait")) != -1 ||
+             (number = tokenNumber(token, tokenLength, "digits")) != -1)
+    {
+      if (number < 0 || number > UINT16_MAX)
+      {
+        *error = "time must be 0..65535 ms";
+        return false;
+      }
+      // The argument is a uint16_t, so digits: presses up to five keys with four gaps
+      bool digits = token[0] == 'd';
+      presses += digits ? 5 : 0;
+      waitMillis += digits ? 4 * number : number;
+      op[0] = digits ? MACRO_OP_DIGITS : MACRO_OP_WAIT;
+      op[1] = number & 0xFF;
+      op[2] = number >> 8;
+      opLength = 3;
+    }
+    else if ((key = keyFromName(token, tokenLength)) >= 0)
+    {
+      presses++;
+      op[0] = MACRO_OP_KEY;
+      op[1] = key;
+      opLength = 2;
+    }
+    else
+    {
+      *error = "unknown key or token";
+      return false;
+    }
+
+    if (length + opLength > MACRO_MAX_CODE)
+    {
+      *error = "macro too long";
+      return false;
+    }
+    // Checked after every token so the totals cannot overflow
+    if (presses > MACRO_MAX_PRESSES || waitMillis > MACRO_MAX_MILLIS)
+    {
+      *error = "macro presses too many keys or waits too long";
+      return false;
+    }
+    memcpy(macro.code + length, op, opLength);
+    length += opLength;
+    token += tokenLength;
+  }
+
+  if (depth != 0)
+  {
+    *error = "repeat without end";
+    return false;
+  }
+  macro.length = length;
+  return true;
+}
+
+static size_t append(char *text, size_t textSize, size_t used, const char *part)
+{
+  size_t partLength = strlen(part);
+  if (used + partLength + 1 <= textSize)
+  {
+    memcpy(text + used, part, partLength + 1);
+    return used + partLength;
+  }
+  return used;
+}
+
+size_t macroDecompile(const Macro &macro, char *text, size_t textSize)
+{
+  size_t used = 0;
+  char part[24];
+  if (textSize > 0)
+  {
+    text[0] = '\0';
+  }
+  for (size_t pc = 0; pc < macro.length;)
+  {
+    if (pc > 0)
+    {
+      used = append(text, textSize, used, ",");
+    }
+    switch (macro.code[pc])
+    {
+    case MACRO_OP_KEY:
+      used = append(text, textSize, used, macro.code[pc + 1] < KEY_COUNT ? keyNames[macro.code[pc + 1]] : "?");
+      pc += 2;
+      break;
+    case MACRO_OP_WAIT:
+    case MACRO_OP_DIGITS:
+      snprintf(part, sizeof(part), "%s:%u", macro.code[pc] == MACRO_OP_WAIT ? "wait" : "digits",
+               macro.code[pc + 1] | (macro.code[pc + 2] << 8));
+      used = append(text, textSize, used, part);
+      pc += 3;
+      break;
+    case MACRO_OP_REPEAT:
+      snprintf(part, sizeof(part), "repeat:%u", macro.code[pc + 1]);
+      used = append(text, textSize, used, part);
+      pc += 2;
+      break;
+    default:
+      used = append(text, textSize, used, "end");
+      pc += 1;
+      break;
+    }
+  }
+  return used;
+}
+
+static void sendDigits(uint16_t argument, uint32_t gap, const MacroTarget &target)
+{
+  // Most significant digit first, at least two digits like the remote's direct tune expects
+  uint16_t divisor = 10;
+  while (divisor * 10 <= argument && divisor < 10000)
+  {
+    divisor *= 10;
+  }
+  for (; divisor > 0; divisor /= 10)
+  {
+    target.sendKey(numberKeys[(argument / divisor) % 10]);
+    if (divisor > 1)
+    {
+      target.wait(gap);
+    }
+  }
+}
+
+void macroRun(const Macro &macro, uint16_t argument, const MacroTarget &target)
+{
+  uint8_t loopStart[MACRO_MAX_DEPTH];
+  uint8_t loopLeft[MACRO_MAX_DEPTH];
+  int depth = 0;
+  size_t pc = 0;
+  while (pc < macro.length)
+  {
+    const uint8_t *op = macro.code + pc;
+    switch (op[0])
+    {
+    case MACRO_OP_KEY:
+      if (op[1] < KEY_COUNT)
+      {
+        target.sendKey((Key)op[1]);
+      }
+      pc += 2;
+      break;
+    case MACRO_OP_WAIT:
+      target.wait(op[1] | (op[2] << 8));
+      pc += 3;
+      break;
+    case MACRO_OP_DIGITS:
+      sendDigits(argument, op[1] | (op[2] << 8), target);
+      pc += 3;
+      break;
+    case MACRO_OP_REPEAT:
+      if (depth == MACRO_MAX_DEPTH)
+      {
+        return;
+      }
+      pc += 2;
+      loopStart[depth] = pc;
+      loopLeft[depth] = op[1];
+      depth++;
+      break;
+    case MACRO_OP_END:
+      if (depth == 0)
+      {
+        return;
+      }
+      if (--loopLeft[depth - 1] > 0)
+      {
+        pc = loopStart[depth - 1];
+      }
+      else
+      {
+        depth--;
+        pc++;
+      }
+      break;
+    default:
+      return; // Corrupt bytecode, compiled macros never get here
+    }
+  }
+}
+
+static void slotKey(int slot, char *key)
+{
+  key[0] = 'm';
+  key[1] = '0' + slot;
+  key[2] = '\0';
+}
+
+// Checks bytecode read back from NVS: known opcodes with their operands, key indices, balanced
+// repeats. A slot written by an older or corrupt firmware would otherwise run garbage.
+static bool macroValid(const Macro &macro)
+{
+  if (macro.length > MACRO_MAX_CODE)
+  {
+    return false;
+  }
+  int depth = 0;
+  for (size_t pc = 0; pc < macro.length;)
+  {
+    const uint8_t *op = macro.code + pc;
+    size_t opLength = op[0] == MACRO_OP_WAIT || op[0] == MACRO_OP_DIGITS ? 3 : op[0] == MACRO_OP_END ? 1 : 2;
+    if (pc + opLength > macro.length)
+    {
+      return false;
+    }
+    switch (op[0])
+    {
+    case MACRO_OP_KEY:
+      if (op[1] >= KEY_COUNT)
+      {
+        return false;
+      }
+      break;
+    case MACRO_OP_REPEAT:
+      if (op[1] == 0 || depth == MACRO_MAX_DEPTH)
+      {
+        return false;
+      }
+      depth++;
+      break;
+    case MACRO_OP_END:
+      if (depth == 0)
+      {
+        return false;
+      }
+      depth--;
+      break;
+    case MACRO_OP_WAIT:
+    case MACRO_OP_DIGITS:
+      break;
+    default:
+      return false;
+    }
+    pc += opLength;
+  }
+  return depth == 0;
+}
+
+void macroBegin()
+{
+  slotsMutex = xSemaphoreCreateMutex();
+  preferences.begin("macros", false);
+  for (int slot = 0; slot < MACRO_SLOTS; slot++)
+  {
+    char key[3];
+    slotKey(slot, key);
+    if (preferences.getBytes(key, &slots[slot], sizeof(Macro)) != sizeof(Macro))
+    {
+      slots[slot].name[0] = '\0';
+    }
+    slots[slot].name[MACRO_MAX_NAME - 1] = '\0';
+    if (slots[slot].name[0] != '\0' && !macroValid(slots[slot]))
+    {
+      logWrite(LOG_LEVEL_WARN, "Macro slot %u invalid, cleared", slot);
+      slots[slot].name[0] = '\0';
+      preferences.remove(key);
+    }
+  }
+  if (macroFind(MACRO_CHANNEL_NAME) < 0)
+  {
+    Macro channel = {MACRO_CHANNEL_NAME, 0, {}};
+    const char *error;
+    macroCompile(MACRO_CHANNEL_DEFAULT, channel, &error);
+    macroStore(channel);
+  }
+}
+
+int macroFind(const char *name)
+{
+  xSemaphoreTake(slotsMutex, portMAX_DELAY);
+  int found = -1;
+  for (int slot = 0; slot < MACRO_SLOTS && found < 0; slot++)
+  {
+    if (slots[slot].name[0] != '\0' && strcmp(slots[slot].name, name) == 0)
+    {
+      found = slot;
+    }
+  }
+  xSemaphoreGive(slotsMutex);
+  return found;
+}
+
+bool macroGet(int slot, Macro &macro)
+{
+  if (slot < 0 || slot >= MACRO_SLOTS)
+  {
+    return false;
+  }
+  xSemaphoreTake(slotsMutex, portMAX_DELAY);
+  macro = slots[slot];
+  xSemaphoreGive(slotsMutex);
+  return macro.name[0] != '\0';
+}
+
+int macroStore(const Macro &macro)
+{
+  int slot = macroFind(macro.name);
+  xSemaphoreTake(slotsMutex, portMAX_DELAY);
+  for (int i = 0; i < MACRO_SLOTS && slot < 0; i++)
+  {
+    if (slots[i].name[0] == '\0')
+    {
+      slot = i;
+    }
+  }
+  if (slot >= 0)
+  {
+    char key[3];
+    slotKey(slot, key);
+    slots[slot] = macro;
+    preferences.putBytes(key, &slots[slot], sizeof(Macro));
+  }
+  xSemaphoreGive(slotsMutex);
+  return slot;
+}
+
+bool macroDelete(const char *name)
+{
+  int slot = macroFind(name);
+  if (slot < 0)
+  {
+    return false;
+  }
+  char key[3];
+  slotKey(slot, key);
+  xSemaphoreTake(slotsMutex, portMAX_DELAY);
+  slots[slot].name[0] = '\0';
+  preferences.remove(key);
+  xSemaphoreGive(slotsMutex);
+  return true;
+}
@@ -0,0 +1,93 @@
+/*
+ *  macro.h
+ *
+ *  IR macros: sequences of keys, waits and repeats compiled into a small bytecode and run by
+ *  the IR task. Macros are written as comma or space separated tokens:
+ *
+ *    <Key>          press a key, names as in keyNames[] ("DirectTune", "VolumeUp", "7", ...)
+ *    wait:<ms>      pause, up to 65535 ms
+ *    repeat:<n>     run everything up to the matching "end" n times (1..255), nests 4 deep
+ *    end
+ *    digits:<ms>    press the decimal digits of the macro argument, at least two, <ms> apart
+ *
+ *  Channel tuning is the macro stored as "channel", by default "DirectTune,wait:400,digits:400".
+ *  Redefining it changes the inter-key gaps of every channel change.
+ *  Macros are kept in MACRO_SLOTS fixed slots and stored in NVS.
+ */
+#ifndef MACRO_H
+#define MACRO_H
+
+#include <Arduino.h>
+
+#include "codes.h"
+
+#define MACRO_SLOTS 8
+#define MACRO_MAX_NAME 16 // Including the terminating zero
+#define MACRO_MAX_CODE 48 // Bytes of bytecode
+#define MACRO_MAX_PRESSES 64   // Key presses and total wait a macro may expand to,
+#define MACRO_MAX_MILLIS 60000 // so one macro cannot hog the emitter
+#define MACRO_MAX_DEPTH 4
+
+// Longest source macroDecompile() writes for MACRO_MAX_CODE bytes, with the terminating zero. A
+// key name and a comma take two bytes of code, the other tokens at most 11 characters
+// ("repeat:255,") for two bytes.
+constexpr size_t macroMaxSource()
+{
+  size_t longest = 11;
+  for (const char *name : keyNames)
+  {
+    size_t length = 1; // The comma
+    while (name[length - 1] != '\0')
+    {
+      length++;
+    }
+    longest = length > longest ? length : longest;
+  }
+  return MACRO_MAX_CODE * longest / 2 + 1;
+}
+
+#define MACRO_MAX_SOURCE macroMaxSource()
+
+#define MACRO_CHANNEL_NAME "channel"
+#define MACRO_CHANNEL_DEFAULT "DirectTune,wait:400,digits:400"
+
+enum MacroOpcode : uint8_t
+{
+  MACRO_OP_KEY = 1, // Key
+  MACRO_OP_WAIT,    // milliseconds, 16 bit little endian
+  MACRO_OP_REPEAT,  // count
+  MACRO_OP_END,
+  MACRO_OP_DIGITS // gap in milliseconds, 16 bit little endian
+};
+
+struct Macro
+{
+  char name[MACRO_MAX_NAME]; // "" for a free slot
+  uint8_t length;
+  uint8_t code[MACRO_MAX_CODE];
+};
+
+// Called by the macro runner, normally with the IR task's sendKey() and delay()
+struct MacroTarget
+{
+  void (*sendKey)(Key key);
+  void (*wait)(uint32_t millis);
+};
+
+// Compiles source into macro.code. On failure returns false and points error at a message.
+bool macroCompile(const char *source, Macro &macro, const char **error);
+
+// Writes the source form of a compiled macro, returns its length. textSize of MACRO_MAX_SOURCE
+// always fits, with less the tokens that do not fit are left out.
+size_t macroDecompile(const Macro &macro, char *text, size_t textSize);
+
+void macroRun(const Macro &macro, uint16_t argument, const MacroTarget &target);
+
+// Slot storage, safe to use from any task
+void macroBegin(); // Loads the slots from NVS and installs the default channel macro
+int macroFind(const char *name); // Slot index or -1
+bool macroGet(int slot, Macro &macro);
+int macroStore(const Macro &macro); // Replaces the macro of the same name or takes a free slot, -1 if full
+bool macroDelete(const char *name);
+
+#endif // MACRO_H
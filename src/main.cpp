@@ -1,369 +1,1046 @@
 
 #include <Arduino.h>
-
-#define DISABLE_CODE_FOR_RECEIVER // Disables restarting receiver after each send. Saves 450 bytes program memory and 269 bytes RAM if receiving functions are not used.
-#include <IRremote.hpp>
 #include <WiFi.h>
+#include <esp_timer.h>
 
-#include "pins.h" // Define macros for input and output pin etc.
+#include "batch.h"
+#include "bootTimeline.h"
+#include "codeDb.h"
 #include "codes.h"
-
-#define NUMBER_OF_REPEATS 3U
+#include "events.h"
+#include "httpParser.h"
+#include "httpServer.h"
+#include "irTask.h"
+#include "logger.h"
+#include "lowPower.h"
+#include "metrics.h"
+#include "page.h"
+#include "planner.h"
+#include "scheduler.h"
+#include "settings.h"
+#include "webSocket.h"
 
 const char *ssid = "Sirrius";
 const char *password = "1234567890";
 
-WiFiServer server(80);
-String header;
+TaskHandle_t serverTaskHandle = NULL;
 
 int currentMode = 0; // Off, jumpDelay, jumpRandom
-String modes[] = {"Off", "Jump Delay", "Jump Random"};
+const char *modes[] = {"Off", "Jump Delay", "Jump Random"};
 
 int favoriteNum = 2;
-String favoriteToJumpTo = "2";
-String secondsDelay = "60";
+uint32_t secondsDelay = 60;
 uint32_t millisDelay = 1000000; // 100 seconds
-uint32_t nextMillis = 0;
 
-struct TaskParameters
-{
-  int currentMode;
-  uint32_t millisDelay;
-  int favoriteNum;
-  // Add other required variables here
-};
-IRsend irsend;
-void sendCommand();
-void doTheSendingTask(void *parameter);
+void handlePage(WiFiClient &client, const HttpRequest &request);
+void redirectToPage(WiFiClient &client);
+void sendError(WiFiClient &client, const char *status);
+void writeHttpMetrics(Print &out);
+void serverTask(void *parameter);
+Settings currentSettings();
 
 void setup()
 {
+  // No waiting for a serial terminal, a headless unit never gets one
   Serial.begin(115200);
-  while (!Serial)
-    ;
+  logBegin();
+  bootMark(BOOT_SETUP);
+  lowPowerBegin();
 
   // Just to know which program is running on my Arduino
-  Serial.println(F("START " __FILE__ " from " __DATE__ "\r\nUsing library version " VERSION_IRREMOTE));
-  Serial.println(F("Send IR signals at pin " STR(IR_SEND_PIN)));
+  Serial.println(F("START " __FILE__ " from " __DATE__));
 
-  IrSender.begin(4, ENABLE_LED_FEEDBACK, 2); // Start with IR_SEND_PIN as send pin and enable feedback LED at default feedback LED pin
+  eventsBegin();
+  // Brings up the access point and the HTTP server on its core while the IR side starts here
+  xTaskCreatePinnedToCore(
+      serverTask,        // Function that should be called
+      "HTTP server",     // Name of the task (for debugging)
+      8192,              // Stack size (bytes), what loop() had
+      NULL,              // Parameter to pass
+      1,                 // Task priority
+      &serverTaskHandle, // Task handle
+      HTTP_SERVER_CORE   // Core
+  );
 
-  Serial.print("Setting AP (Access Point)…");
-  // Remove the password parameter, if you want the AP (Access Point) to be open
-  WiFi.softAP(ssid, password);
+  codeDbBegin();
+  Settings settings = currentSettings();
+  if (settingsBegin(settings))
+  {
+    currentMode = settings.mode;
+    favoriteNum = settings.favorite;
+    secondsDelay = settings.secondsDelay;
+    millisDelay = settings.millisDelay;
+  }
+  irTaskStart();
+  schedulerStart();
+  // Resumed before Wi-Fi is up, the first jump does not wait for the access point
+  if (currentMode != MODE_OFF)
+  {
+    logWriteText(LOG_LEVEL_INFO, "Resuming %s", modes[currentMode]);
+    schedulerConfigure({(uint8_t)currentMode, (uint8_t)favoriteNum, millisDelay});
+  }
+  bootMark(BOOT_IR_READY);
+  xTaskNotifyGive(serverTaskHandle);
+}
 
-  IPAddress IP = WiFi.softAPIP();
-  Serial.print("AP IP address: ");
-  Serial.println(IP);
+Settings currentSettings()
+{
+  return {(uint8_t)currentMode, (uint8_t)favoriteNum, secondsDelay, millisDelay};
+}
 
-  server.begin();
+// Stores the mode and hands it with the current favorite and delay to the scheduler task
+void setMode(int mode)
+{
+  currentMode = mode;
+  schedulerConfigure({(uint8_t)currentMode, (uint8_t)favoriteNum, millisDelay});
+  settingsChanged(currentSettings());
+  eventPost(EVENT_STATE);
 }
 
-TaskHandle_t sendingTaskHandle = NULL;
+// Actions shared by the HTTP routes and the WebSocket commands. Each of them turns the jump mode
+// off first like the page always did. False or 0 if the value is out of range.
+bool setFavoriteNumber(long fave)
+{
+  setMode(MODE_OFF);
+  if (fave < 0 || fave > 9)
+  {
+    return false;
+  }
+  favoriteNum = fave;
+  settingsChanged(currentSettings());
+  logWrite(LOG_LEVEL_INFO, "Set favoriteToJumpTo to: %d", favoriteNum);
+  return true;
+}
 
-void startTask()
+bool setDelaySeconds(long seconds)
 {
-  // Create an instance of TaskParameters
-  TaskParameters *taskParams = new TaskParameters;
+  setMode(MODE_OFF);
+  // A day at most, like scheduled jobs, so the milliseconds fit in 32 bits
+  if (seconds <= 0 || seconds > 86400)
+  {
+    return false;
+  }
+  secondsDelay = seconds;
+  millisDelay = secondsDelay * 1000;
+  settingsChanged(currentSettings());
+  logWrite(LOG_LEVEL_INFO, "Set secondsDelay to: %u", secondsDelay);
+  return true;
+}
 
-  // Set initial values for the variables
-  taskParams->currentMode = currentMode;
-  taskParams->millisDelay = millisDelay;
-  taskParams->favoriteNum = favoriteNum;
+uint32_t goToChannel(long channel, uint8_t emitters = IR_ALL_EMITTERS)
+{
+  setMode(MODE_OFF);
+  if (channel < 0 || channel > IR_MAX_CHANNEL)
+  {
+    return 0;
+  }
+  logWrite(LOG_LEVEL_INFO, "Set channel to: %d", channel);
+  Plan plan;
+  return plannerGoTo(channel, plan, emitters);
+}
 
-  if (sendingTaskHandle != NULL)
+uint32_t goToFave(long fave, uint8_t emitters = IR_ALL_EMITTERS)
+{
+  setMode(MODE_OFF);
+  if (fave < 0 || fave > 9)
   {
-    // Delete the existing task
-    vTaskDelete(sendingTaskHandle);
-    sendingTaskHandle = NULL;
+    return 0;
   }
+  logWrite(LOG_LEVEL_INFO, "Set fave to: %d", fave);
+  return irEnqueue(IR_COMMAND_FAVORITE, fave, 0, emitters);
+}
 
-  // Create a new task with the updated parameters
-  xTaskCreate(
-      doTheSendingTask,  // Function that should be called
-      "Send IR code ",   // Name of the task (for debugging)
-      10000,             // Stack size (bytes)
-      taskParams,        // Parameter to pass
-      1,                 // Task priority
-      &sendingTaskHandle // Task handle
-  );
+uint32_t power(uint8_t emitters = IR_ALL_EMITTERS)
+{
+  setMode(MODE_OFF);
+  logWrite(LOG_LEVEL_INFO, "PWR");
+  return irEnqueue(IR_COMMAND_POWER, 0, 0, emitters);
 }
 
-void cleanupTask(TaskParameters *params)
+// Queues the key of that name, or the code database's code for names without a Key. Returns false
+// if neither knows the name, id is 0 then or if the queue is full.
+bool enqueueKeyName(const char *name, size_t length, uint32_t &id, uint8_t emitters = IR_ALL_EMITTERS)
 {
-  delete params;
+  int key = keyFromName(name, length);
+  int code = key < 0 ? codeDbFind(name, length) : -1;
+  id = key >= 0    ? irEnqueue(IR_COMMAND_KEY, key, 0, emitters)
+       : code >= 0 ? irEnqueue(IR_COMMAND_CODE, code, 0, emitters)
+                   : 0;
+  return key >= 0 || code >= 0;
 }
-void KillTask()
+
+// Holds the key of that name for holdMillis, or until released. Returns false for names without a Key.
+bool holdKeyName(const char *name, size_t length, long holdMillis, uint32_t &id, uint8_t emitters = IR_ALL_EMITTERS)
+{
+  int key = keyFromName(name, length);
+  id = key >= 0 ? irEnqueue(IR_COMMAND_HOLD, key, holdMillis, emitters) : 0;
+  return key >= 0;
+}
+
+// Optional emitters= of the routes that send, a comma separated list of emitter numbers like
+// "0,2". Without it a command goes out on all emitters. False for emitters that are not there.
+bool emittersQuery(const HttpRequest &request, uint8_t &emitters)
 {
-  currentMode = 0;
-  if (sendingTaskHandle != NULL)
+  char list[3 * IR_MAX_EMITTERS];
+  emitters = IR_ALL_EMITTERS;
+  const char *value;
+  size_t length;
+  if (!httpQueryValue(request, "emitters", &value, &length))
   {
-    // Delete the existing task
-    vTaskDelete(sendingTaskHandle);
-    sendingTaskHandle = NULL;
+    return true;
   }
+  if (!httpQueryText(request, "emitters", list, sizeof(list)))
+  {
+    return false;
+  }
+  char *next = list;
+  do
+  {
+    char *end;
+    long emitter = strtol(next, &end, 10);
+    if (end == next || emitter < 0 || emitter >= irEmitterCount() || (*end != ',' && *end != '\0'))
+    {
+      return false;
+    }
+    emitters |= 1 << emitter;
+    next = end + 1;
+  } while (next[-1] == ',');
+  return true;
 }
-String getTextBoxValue(String InputName)
+
+// Route handlers, the ones changing the mode or sending keys redirect to the page, the others answer with JSON
+void handleModeOff(WiFiClient &client, const HttpRequest &request)
+{
+  setMode(MODE_OFF);
+  logWrite(LOG_LEVEL_INFO, "set to off");
+  redirectToPage(client);
+}
+
+void handlePower(WiFiClient &client, const HttpRequest &request)
 {
-  int paramIndex = header.indexOf(InputName + "=");
-  if (paramIndex >= 0)
+  uint8_t emitters;
+  if (!emittersQuery(request, emitters))
   {
-    int endIndex = header.indexOf(" ", paramIndex);
-    String numberValue = header.substring(paramIndex + InputName.length() + 1, endIndex);
-    return numberValue;
+    sendError(client, "400 Bad Request");
+    return;
   }
-  return "";
+  power(emitters);
+  redirectToPage(client);
 }
 
-void setChannel(int channel)
+void handleJumpDelay(WiFiClient &client, const HttpRequest &request)
 {
-  Serial.println(channel);
-  int channelTens = channel % 10;
-  int channelOnes = channel / 10;
-  irsend.sendPronto(DirectTuneBTN, NUMBER_OF_REPEATS);
-  delay(400);
-  irsend.sendPronto(numberBTNs[channelOnes], NUMBER_OF_REPEATS);
-  delay(400);
-  irsend.sendPronto(numberBTNs[channelTens], NUMBER_OF_REPEATS);
+  logWrite(LOG_LEVEL_INFO, "set toJumpDelay");
+  setMode(MODE_JUMP_DELAY);
+  redirectToPage(client);
 }
 
-void setFave(int fave)
+void handleJumpRandom(WiFiClient &client, const HttpRequest &request)
 {
-  Serial.println(fave);
-  irsend.sendPronto(numberBTNs[fave], NUMBER_OF_REPEATS);
+  logWrite(LOG_LEVEL_INFO, "set to JumpRandom");
+  setMode(MODE_JUMP_RANDOM);
+  redirectToPage(client);
 }
-void powerBtn()
+
+void handleFavoriteNumber(WiFiClient &client, const HttpRequest &request)
 {
-  irsend.sendPronto(PowerBTN, NUMBER_OF_REPEATS);
+  long fave;
+  // A missing or malformed value leaves the setting as it is
+  if (httpQueryLong(request, "favoriteNumberInput", &fave))
+  {
+    setFavoriteNumber(fave);
+  }
+  redirectToPage(client);
 }
-void loop()
+
+void handleDelayNumber(WiFiClient &client, const HttpRequest &request)
+{
+  long seconds;
+  if (httpQueryLong(request, "delayNumberInput", &seconds))
+  {
+    setDelaySeconds(seconds);
+  }
+  redirectToPage(client);
+}
+
+void handleSetChannel(WiFiClient &client, const HttpRequest &request)
+{
+  long channel;
+  uint8_t emitters;
+  if (!emittersQuery(request, emitters))
+  {
+    sendError(client, "400 Bad Request");
+    return;
+  }
+  if (httpQueryLong(request, "setChannelInput", &channel))
+  {
+    goToChannel(channel, emitters);
+  }
+  redirectToPage(client);
+}
+
+void handleSetFave(WiFiClient &client, const HttpRequest &request)
+{
+  long fave;
+  uint8_t emitters;
+  if (!emittersQuery(request, emitters))
+  {
+    sendError(client, "400 Bad Request");
+    return;
+  }
+  if (httpQueryLong(request, "setFaveInput", &fave))
+  {
+    goToFave(fave, emitters);
+  }
+  redirectToPage(client);
+}
+
+void sendJsonHeader(WiFiClient &client, const char *status)
 {
+  client.print("HTTP/1.1 ");
+  client.println(status);
+  client.println("Content-type:application/json");
+  client.println("Connection: close");
+  client.println();
+}
 
-  WiFiClient client = server.available(); // Listen for incoming clients
-
-  if (client)
-  {                                // If a new client connects,
-    Serial.println("New Client."); // print a message out in the serial port
-    String currentLine = "";       // make a String to hold incoming data from the client
-    while (client.connected())
-    { // loop while the client's connected
-      if (client.available())
-      {                         // if there's bytes to read from the client,
-        char c = client.read(); // read a byte, then
-        Serial.write(c);        // print it out the serial monitor
-        header += c;
-        if (c == '\n')
-        { // if the byte is a newline character
-          // if the current line is blank, you got two newline characters in a row.
-          // that's the end of the client HTTP request, so send a response:
-          if (currentLine.length() == 0)
-          {
-            // HTTP headers always start with a response code (e.g. HTTP/1.1 200 OK)
-            // and a content-type so the client knows what's coming, then a blank line:
-            client.println("HTTP/1.1 200 OK");
-            client.println("Content-type:text/html");
-            client.println("Connection: close");
-            client.println();
-
-            // turns the GPIOs on and off
-            if (header.indexOf("GET /mode/Modeoff") >= 0)
-            {
-              KillTask();
-              Serial.println("set to off");
-              currentMode = 0;
-            }
-            else if (header.indexOf("GET /mode/Pwr") >= 0)
-            {
-              KillTask();
-              Serial.println("PWR");
-              currentMode = 0;
-              powerBtn();
-            }
-
-            else if (header.indexOf("GET /mode/JumpDelay") >= 0)
-            {
-              KillTask();
-              Serial.println("set toJumpDelay");
-              currentMode = 1;
-              startTask();
-            }
-            else if (header.indexOf("GET /mode/JumpRandom") >= 0)
-            {
-              KillTask();
-              Serial.println("set to JumpRandom");
-              currentMode = 2;
-              startTask();
-            }
-            // Handle form submission
-            else if (header.indexOf("GET favoriteNumber") >= 0)
-            {
-              KillTask();
-              if (favoriteToJumpTo = getTextBoxValue("favoriteNumberInput"))
-              {
-                Serial.println("Set favoriteToJumpTo to: " + favoriteToJumpTo);
-                favoriteNum = favoriteToJumpTo.toInt();
-              }
-            }
-            // Handle form submission for delayNumber
-            else if (header.indexOf("GET /delayNumber") >= 0)
-            {
-              KillTask();
-              if (secondsDelay = getTextBoxValue("delayNumberInput"))
-              {
-                Serial.println("Set secondsDelay to: " + secondsDelay);
-                millisDelay = secondsDelay.toInt() * 1000;
-              }
-            }
-            else if (header.indexOf("GET /setChannel") >= 0)
-            {
-              KillTask();
-              if (String channel = getTextBoxValue("setChannelInput"))
-              {
-                Serial.println("Set channel to: " + channel);
-                setChannel(channel.toInt());
-              }
-            }
-                       else if (header.indexOf("GET /setFave") >= 0)
-            {
-              KillTask();
-              if (String fave = getTextBoxValue("setFaveInput"))
-              {
-                Serial.println("Set fave to: " + fave);
-                setFave(fave.toInt());
-              }
-            }
-
-            // Display the HTML web page
-            client.println("<!DOCTYPE html><html>");
-            client.println("<head><meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">");
-            client.println("<link rel=\"icon\" href=\"data:,\">");
-            // CSS to style the on/off buttons
-            // Feel free to change the background-color and font-size attributes to fit your preferences
-            client.println("<style>html { font-family: Helvetica; display: inline-block; margin: 0px auto; text-align: center;}");
-            client.println(".button { background-color: #4CAF50; border: none; color: white; padding: 16px 40px;");
-            client.println("text-decoration: none; font-size: 30px; margin: 2px; cursor: pointer;}");
-            client.println(".button2 {background-color: #555555;}</style></head>");
-
-            // Web Page Heading
-            client.println("<body><h1>Sirrius</h1>");
-
-            // Display current state
-            client.println("<p>Current Mode: " + modes[currentMode] + "</p>");
-
-            // Display current values
-            client.println("<p>Current Favorite: " + favoriteToJumpTo + "</p>");
-            client.println("<p>Current delay: " + secondsDelay + "</p>");
-
-            // form to get favorite number
-            client.println("<form action=\"favoriteNumber\" method=\"get\">");
-            client.println("<label for=\"favoriteNumberInput\">Enter a Favorite:</label>");
-            client.println("<input type=\"text\" id=\"favoriteNumberInput\" name=\"favoriteNumberInput\" required>");
-            client.println("<input type=\"submit\" value=\"Submit\">");
-            client.println("</form>");
-
-            // for to get delay time
-            client.println("<form action=\"/delayNumber\" method=\"get\">");
-            client.println("<label for=\"delayNumberInput\">Enter a delay(sec):</label>");
-            client.println("<input type=\"text\" id=\"delayNumberInput\" name=\"delayNumberInput\" required>");
-            client.println("<input type=\"submit\" value=\"Submit\">");
-            client.println("</form>");
-
-            // buttons
-            client.println("<p><a href=\"/mode/JumpDelay\"><button class=\"button\">jump delay to favorite " + favoriteToJumpTo + "</button></a></p>");
-            client.println("<p><a href=\"/mode/JumpRandom\"><button class=\"button\">jump random to favorite " + favoriteToJumpTo + "</button></a></p>");
-            client.println("<p><a href=\"/mode/Modeoff\"><button class=\"button\">MODE OFF</button></a></p>");
-
-
-            // form to go to channel
-            client.println("<form action=\"/setChannel\" method=\"get\">");
-            client.println("<label for=\"setChannelInput\">GoTo Channel:</label>");
-            client.println("<input type=\"text\" id=\"setChannelInput\" name=\"setChannelInput\" required>");
-            client.println("<input type=\"submit\" value=\"Submit\">");
-            client.println("</form>");
-
-            // form to go to favorite
-            client.println("<form action=\"/setFave\" method=\"get\">");
-            client.println("<label for=\"setFaveInput\">GoTo Channel:</label>");
-            client.println("<input type=\"text\" id=\"setFaveInput\" name=\"setFaveInput\" required>");
-            client.println("<input type=\"submit\" value=\"Submit\">");
-            client.println("</form>");
-
-            client.println("<p><a href=\"/mode/Pwr\"><button class=\"button\">POWER</button></a></p>");
-            //client.println("<p><a href=\"/mode/PwrOff\"><button class=\"button\">OFF</button></a></p>");
-
-            client.println("</body></html>");
-            // The HTTP response ends with another blank line
-            client.println();
-            // Break out of the while loop
-            break;
-          }
-          else
-          { // if you got a newline, then clear currentLine
-            currentLine = "";
-          }
-        }
-        else if (c != '\r')
-        {                   // if you got anything else but a carriage return character,
-          currentLine += c; // add it to the end of the currentLine
-        }
-      }
+// /key/<name> presses any key of the remote, names as in keyNames[] ("VolumeUp", "7", ...)
+void handleKey(WiFiClient &client, const HttpRequest &request)
+{
+  const char *name = request.path + strlen("/key/");
+  long holdMillis;
+  uint32_t id;
+  bool known;
+  uint8_t emitters;
+  if (!emittersQuery(request, emitters))
+  {
+    sendError(client, "400 Bad Request");
+    return;
+  }
+  if (httpQueryLong(request, "hold", &holdMillis))
+  {
+    if (holdMillis <= 0 || holdMillis > IR_MAX_HOLD_MILLIS)
+    {
+      sendError(client, "400 Bad Request");
+      return;
     }
+    known = holdKeyName(name, strlen(name), holdMillis, id, emitters);
+  }
+  else
+  {
+    known = enqueueKeyName(name, strlen(name), id, emitters);
+  }
+  if (!known)
+  {
+    sendJsonHeader(client, "404 Not Found");
+    client.println("{\"error\":\"no such key\"}");
+    return;
+  }
+  sendJsonHeader(client, id != 0 ? "200 OK" : "503 Service Unavailable");
+  client.print("{\"id\":");
+  client.print(id);
+  client.println("}");
+}
 
-    // Clear the header variable
-    header = "";
-    // Close the connection
-    client.stop();
-    Serial.println("Client disconnected.");
-    Serial.println("");
+// Ends the holds queued so far, see irRelease()
+void handleRelease(WiFiClient &client, const HttpRequest &request)
+{
+  irRelease();
+  sendJsonHeader(client, "200 OK");
+  client.print("{\"releasedThrough\":");
+  client.print(irLastQueued());
+  client.println("}");
+}
+
+// Names of all keys for /key/<name>, in the order of the remote's function list, then the
+// codes only the code database has
+void handleKeys(WiFiClient &client, const HttpRequest &request)
+{
+  sendJsonHeader(client, "200 OK");
+  client.print("[");
+  for (int key = 0; key < KEY_COUNT; key++)
+  {
+    client.print(key == 0 ? "\"" : ",\"");
+    client.print(keyNames[key]);
+    client.print("\"");
   }
+  for (size_t index = KEY_COUNT; index < codeDbCount(); index++)
+  {
+    const CodeDbEntry *entry = codeDbEntry(index);
+    client.print(",\"");
+    client.write((const uint8_t *)entry->name, entry->nameLength);
+    client.print("\"");
+  }
+  client.println("]");
 }
 
-void doTheSendingTask(void *parameter)
+// Receiver model and the planner's last decision, see planner.h
+void handlePlanner(WiFiClient &client, const HttpRequest &request)
 {
-  // Cast the parameter back to the structure type
-  TaskParameters *params = (TaskParameters *)parameter;
+  sendJsonHeader(client, "200 OK");
+  plannerWriteJson(client);
+}
 
-  uint32_t nextMillisTask = 0;
-  int mode = params->currentMode;
-  uint32_t millisDelayTask = params->millisDelay;
-  int channelTask = params->favoriteNum;
-  cleanupTask(params);
-  while (1)
+// Tells the model what the receivers of the emitters show, after they were tuned by hand. No channel forgets it.
+void handlePlannerChannel(WiFiClient &client, const HttpRequest &request)
+{
+  long channel = PLANNER_UNKNOWN;
+  const char *text;
+  size_t length;
+  uint8_t emitters;
+  if (!emittersQuery(request, emitters) ||
+      (httpQueryValue(request, "channel", &text, &length) && !httpQueryLong(request, "channel", &channel)))
+  {
+    sendError(client, "400 Bad Request");
+    return;
+  }
+  plannerSetChannel(channel, emitters);
+  handlePlanner(client, request);
+}
+
+// Teaches the model which channel a favorite digit tunes to, channel=-1 forgets it
+void handlePlannerFavorite(WiFiClient &client, const HttpRequest &request)
+{
+  long fave;
+  long channel;
+  if (!httpQueryLong(request, "fave", &fave) || !httpQueryLong(request, "channel", &channel) ||
+      !plannerSetFavorite(fave, channel))
+  {
+    sendError(client, "400 Bad Request");
+    return;
+  }
+  handlePlanner(client, request);
+}
+
+// Queue state as JSON, a command is done once lastCompleted >= its id
+void handleIrStatus(WiFiClient &client, const HttpRequest &request)
+{
+  sendJsonHeader(client, "200 OK");
+  client.print("{\"queued\":");
+  client.print(irQueueDepth());
+  client.print(",\"lastQueued\":");
+  client.print(irLastQueued());
+  client.print(",\"lastCompleted\":");
+  client.print(irLastCompleted());
+  client.print(",\"coalesced\":");
+  client.print(irCoalescedCount());
+  client.print(",\"deferred\":");
+  client.print(irDeferredCount());
+  client.println("}");
+}
+
+const char *commandNames[] = {"key", "channel", "favorite", "power", "macro", "wait", "batch", "code", "hold"};
+
+// Scheduled jobs in due order, the jump mode is one of them
+void handleSchedule(WiFiClient &client, const HttpRequest &request)
+{
+  ScheduledJobInfo jobs[SCHEDULER_MAX_JOBS];
+  size_t count = schedulerList(jobs, SCHEDULER_MAX_JOBS);
+  sendJsonHeader(client, "200 OK");
+  client.print("[");
+  for (size_t i = 0; i < count; i++)
+  {
+    client.print(i == 0 ? "{\"id\":" : ",{\"id\":");
+    client.print(jobs[i].id);
+    client.print(",\"command\":\"");
+    client.print(commandNames[jobs[i].job.command]);
+    client.print("\",\"value\":");
+    client.print(jobs[i].job.value);
+    client.print(",\"everyMs\":");
+    client.print(jobs[i].job.periodMillis);
+    client.print(",\"jitterMs\":");
+    client.print(jobs[i].job.jitterMillis);
+    client.print(",\"emitters\":");
+    client.print(jobs[i].job.emitters);
+    client.print(",\"dueInMs\":");
+    client.print((long)(jobs[i].dueInMicros / 1000));
+    client.print("}");
+  }
+  client.println("]");
+}
+
+// /schedule/add?fave=3&every=600 sends favorite 3 every 10 minutes, key= and channel= work the same.
+// Optional jitter= adds up to that many random seconds to each period, emitters= picks where it is sent.
+void handleScheduleAdd(WiFiClient &client, const HttpRequest &request)
+{
+  long value;
+  long every;
+  long jitter = 0;
+  ScheduledJob job = {IR_COMMAND_KEY, 0, 0, 0, IR_ALL_EMITTERS};
+  if (!emittersQuery(request, job.emitters))
+  {
+    sendJsonHeader(client, "400 Bad Request");
+    client.println("{\"error\":\"no such emitter\"}");
+    return;
+  }
+  if (httpQueryLong(request, "fave", &value) && value >= 0 && value <= 9)
+  {
+    job.command = IR_COMMAND_FAVORITE;
+  }
+  else if (httpQueryLong(request, "channel", &value) && value >= 0 && value <= IR_MAX_CHANNEL)
+  {
+    job.command = IR_COMMAND_CHANNEL;
+  }
+  else if (!httpQueryLong(request, "key", &value) || value < 0 || value >= KEY_COUNT)
+  {
+    sendJsonHeader(client, "400 Bad Request");
+    client.println("{\"error\":\"fave, channel or key missing\"}");
+    return;
+  }
+  if (!httpQueryLong(request, "every", &every) || every <= 0 || every > 86400 ||
+      (httpQueryLong(request, "jitter", &jitter) && (jitter < 0 || jitter > 86400)))
+  {
+    sendJsonHeader(client, "400 Bad Request");
+    client.println("{\"error\":\"every must be 1..86400 seconds\"}");
+    return;
+  }
+  job.value = value;
+  job.periodMillis = every * 1000;
+  job.jitterMillis = jitter * 1000;
+  uint16_t id = schedulerAdd(job, job.periodMillis);
+  if (id == 0)
+  {
+    sendJsonHeader(client, "503 Service Unavailable");
+    client.println("{\"error\":\"no free schedule slot\"}");
+    return;
+  }
+  sendJsonHeader(client, "200 OK");
+  client.print("{\"id\":");
+  client.print(id);
+  client.println("}");
+}
+
+void handleScheduleRemove(WiFiClient &client, const HttpRequest &request)
+{
+  long id;
+  bool removed = httpQueryLong(request, "id", &id) && id > 0 && id <= UINT16_MAX && schedulerRemove(id);
+  sendJsonHeader(client, removed ? "200 OK" : "404 Not Found");
+  client.println(removed ? "{\"removed\":true}" : "{\"removed\":false}");
+}
+
+// Stored macros with their source, see macro.h for the syntax
+void handleMacros(WiFiClient &client, const HttpRequest &request)
+{
+  sendJsonHeader(client, "200 OK");
+  client.print("[");
+  bool first = true;
+  for (int slot = 0; slot < MACRO_SLOTS; slot++)
   {
+    Macro macro;
+    if (!macroGet(slot, macro))
+    {
+      continue;
+    }
+    char source[MACRO_MAX_SOURCE];
+    macroDecompile(macro, source, sizeof(source));
+    client.print(first ? "{\"name\":\"" : ",{\"name\":\"");
+    client.print(macro.name);
+    client.print("\",\"bytes\":");
+    client.print(macro.length);
+    client.print(",\"code\":\"");
+    client.print(source);
+    client.print("\"}");
+    first = false;
+  }
+  client.println("]");
+}
 
-    delay(1000);
-    Serial.print("waiting:");
-    Serial.println(mode);
+bool validMacroName(const char *name)
+{
+  if (*name == '\0')
+  {
+    return false;
+  }
+  for (; *name != '\0'; name++)
+  {
+    if (!isalnum(*name) && *name != '_' && *name != '-')
+    {
+      return false;
+    }
+  }
+  return true;
+}
 
-    // Access variables using the structure
-    switch (mode)
+// /macro/define?name=vol3&code=repeat:3,VolumeUp,wait:200,end
+void handleMacroDefine(WiFiClient &client, const HttpRequest &request)
+{
+  Macro macro = {};
+  char source[HTTP_MAX_REQUEST_LINE];
+  const char *error = "name or code missing";
+  if (httpQueryText(request, "name", macro.name, sizeof(macro.name)) && validMacroName(macro.name) &&
+      httpQueryText(request, "code", source, sizeof(source)) && macroCompile(source, macro, &error))
+  {
+    if (macroStore(macro) >= 0)
     {
-    case 0:
-      Serial.println("doing nothing");
+      sendJsonHeader(client, "200 OK");
+      client.print("{\"bytes\":");
+      client.print(macro.length);
+      client.println("}");
+      return;
+    }
+    error = "no free macro slot";
+  }
+  sendJsonHeader(client, "400 Bad Request");
+  client.print("{\"error\":\"");
+  client.print(error);
+  client.println("\"}");
+}
+
+// /macro/run?name=vol3, arg= is pressed by a digits: step
+void handleMacroRun(WiFiClient &client, const HttpRequest &request)
+{
+  char name[MACRO_MAX_NAME];
+  long argument = 0;
+  uint8_t emitters;
+  int slot = httpQueryText(request, "name", name, sizeof(name)) ? macroFind(name) : -1;
+  if (slot < 0 || (httpQueryLong(request, "arg", &argument) && (argument < 0 || argument > UINT16_MAX)))
+  {
+    sendJsonHeader(client, "404 Not Found");
+    client.println("{\"error\":\"no such macro\"}");
+    return;
+  }
+  if (!emittersQuery(request, emitters))
+  {
+    sendJsonHeader(client, "400 Bad Request");
+    client.println("{\"error\":\"no such emitter\"}");
+    return;
+  }
+  uint32_t id = irEnqueue(IR_COMMAND_MACRO, slot, argument, emitters);
+  sendJsonHeader(client, id != 0 ? "200 OK" : "503 Service Unavailable");
+  client.print("{\"id\":");
+  client.print(id);
+  client.println("}");
+}
+
+void handleMacroDelete(WiFiClient &client, const HttpRequest &request)
+{
+  char name[MACRO_MAX_NAME];
+  bool deleted = httpQueryText(request, "name", name, sizeof(name)) && macroDelete(name);
+  sendJsonHeader(client, deleted ? "200 OK" : "404 Not Found");
+  client.println(deleted ? "{\"deleted\":true}" : "{\"deleted\":false}");
+}
+
+// What the page shows as JSON, fields is put in front of the values
+int stateJson(char *json, size_t size, const char *fields)
+{
+  return snprintf(json, size, "{%s\"mode\":\"%s\",\"modeIndex\":%d,\"favorite\":%d,\"delay\":%lu}", fields,
+                  modes[currentMode], currentMode, favoriteNum, (unsigned long)secondsDelay);
+}
+
+// The page fetches this after loading when it has no WebSocket. Polled a lot, so it goes out in
+// one write instead of through sendJsonHeader().
+void handleState(WiFiClient &client, const HttpRequest &request)
+{
+  char json[112];
+  int jsonLength = stateJson(json, sizeof(json), "");
+  char response[224];
+  int length = snprintf(response, sizeof(response),
+                        "HTTP/1.1 200 OK\r\nContent-type:application/json\r\nContent-Length: %d\r\n"
+                        "Cache-Control: no-store\r\nConnection: close\r\n\r\n%s",
+                        jsonLength, json);
+  client.write((const uint8_t *)response, length);
+}
+
+// Boot phases in microseconds since power-on, see bootTimeline.h
+void handleBoot(WiFiClient &client, const HttpRequest &request)
+{
+  sendJsonHeader(client, "200 OK");
+  bootWriteJson(client);
+}
+
+// Prometheus text format, scrape http://192.168.4.1/metrics
+void handleMetrics(WiFiClient &client, const HttpRequest &request)
+{
+  // Headers and all families go out in full segments instead of one per print()
+  MetricsBuffer out(client);
+  out.println("HTTP/1.1 200 OK");
+  out.println("Content-type:text/plain; version=0.0.4");
+  out.println("Connection: close");
+  out.println();
+
+  writeHttpMetrics(out);
+  httpServerWriteMetrics(out);
+  irWriteMetrics(out);
+  schedulerWriteMetrics(out);
+  settingsWriteMetrics(out);
+  plannerWriteMetrics(out);
+  logWriteMetrics(out);
+  bootWriteMetrics(out);
+  lowPowerWriteMetrics(out);
+  metricsWriteFamily(out, "sirius_websocket_clients", "gauge", "Connected WebSocket clients.");
+  metricsWriteSample(out, "sirius_websocket_clients", "", webSocketClientCount());
+
+  metricsWriteFamily(out, "sirius_heap_free_bytes", "gauge", "Free heap.");
+  metricsWriteSample(out, "sirius_heap_free_bytes", "", ESP.getFreeHeap());
+  metricsWriteFamily(out, "sirius_heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+  metricsWriteSample(out, "sirius_heap_min_free_bytes", "", ESP.getMinFreeHeap());
+  metricsWriteFamily(out, "sirius_stack_high_water_bytes", "gauge", "Stack a task has never used.");
+  metricsWriteSample(out, "sirius_stack_high_water_bytes", "task=\"server\"", uxTaskGetStackHighWaterMark(NULL));
+  metricsWriteSample(out, "sirius_stack_high_water_bytes", "task=\"ir\"", irStackHighWaterMark());
+  metricsWriteSample(out, "sirius_stack_high_water_bytes", "task=\"scheduler\"", schedulerStackHighWaterMark());
+}
+
+// POST /batch with steps in the body (see batch.h), answered with one JSON line per step as it is done.
+// POST /batch?emitters=1 sends all steps on emitter 1 only.
+void handleBatch(WiFiClient &client, const HttpRequest &request)
+{
+  IrBatch batch;
+  size_t failedStep;
+  const char *error;
+  uint8_t emitters;
+  if (!emittersQuery(request, emitters))
+  {
+    sendJsonHeader(client, "400 Bad Request");
+    client.println("{\"error\":\"no such emitter\"}");
+    return;
+  }
+  if (!batchParse(request.body, batch, &failedStep, &error))
+  {
+    sendJsonHeader(client, "400 Bad Request");
+    client.print("{\"error\":\"step ");
+    client.print(failedStep);
+    client.print(": ");
+    client.print(error);
+    client.println("\"}");
+    return;
+  }
+  uint32_t id = irEnqueueBatch(batch, emitters);
+  if (id == 0)
+  {
+    sendJsonHeader(client, "503 Service Unavailable");
+    client.println("{\"error\":\"IR queue or batch slots full\"}");
+    return;
+  }
+  batchStreamStart(client, id, batch.length);
+}
+
+// Upgrades to a WebSocket that gets state changes, job firings and IR sends pushed to it and
+// takes commands as frames, see handleSocketCommand()
+void handleWebSocket(WiFiClient &client, const HttpRequest &request)
+{
+  if (!request.upgradeWebSocket || strlen(request.webSocketKey) != WS_KEY_LENGTH)
+  {
+    sendError(client, "400 Bad Request");
+    return;
+  }
+  int socket = webSocketAccept(client, request.webSocketKey);
+  if (socket >= 0)
+  {
+    char json[128];
+    webSocketSend(socket, json, stateJson(json, sizeof(json), "\"type\":\"state\","));
+  }
+}
+
+// Commands of the page over its WebSocket, the same actions as its links and forms:
+// "mode off", "mode delay", "mode random", "power", "favorite N", "delay N", "channel N", "fave N",
+// "key <name>", "hold <name> <ms>", "release".
+// Settings are answered by the state broadcast, IR commands with their id.
+void handleSocketCommand(int socket, const char *text, size_t length)
+{
+  char name[12];
+  long value;
+  bool hasValue = sscanf(text, "%11s %ld", name, &value) == 2;
+  bool sendsIr = false;
+  bool valid = true;
+  uint32_t id = 0;
+  if (strcmp(text, "mode off") == 0)
+  {
+    setMode(MODE_OFF);
+  }
+  else if (strcmp(text, "mode delay") == 0)
+  {
+    setMode(MODE_JUMP_DELAY);
+  }
+  else if (strcmp(text, "mode random") == 0)
+  {
+    setMode(MODE_JUMP_RANDOM);
+  }
+  else if (strcmp(text, "power") == 0)
+  {
+    sendsIr = true;
+    id = power();
+  }
+  else if (strncmp(text, "key ", 4) == 0)
+  {
+    valid = enqueueKeyName(text + 4, length - 4, id);
+    sendsIr = true;
+  }
+  else if (strncmp(text, "hold ", 5) == 0)
+  {
+    char key[CODE_DB_MAX_NAME + 1];
+    long holdMillis;
+    valid = sscanf(text + 5, "%15s %ld", key, &holdMillis) == 2 && holdMillis > 0 &&
+            holdMillis <= IR_MAX_HOLD_MILLIS && holdKeyName(key, strlen(key), holdMillis, id);
+    sendsIr = true;
+  }
+  else if (strcmp(text, "release") == 0)
+  {
+    irRelease();
+  }
+  else if (hasValue && strcmp(name, "favorite") == 0)
+  {
+    valid = setFavoriteNumber(value);
+  }
+  else if (hasValue && strcmp(name, "delay") == 0)
+  {
+    valid = setDelaySeconds(value);
+  }
+  else if (hasValue && strcmp(name, "channel") == 0)
+  {
+    sendsIr = true;
+    id = goToChannel(value);
+  }
+  else if (hasValue && strcmp(name, "fave") == 0)
+  {
+    sendsIr = true;
+    id = goToFave(value);
+  }
+  else
+  {
+    valid = false;
+  }
+
+  char reply[96];
+  if (!valid || (sendsIr && id == 0))
+  {
+    length = snprintf(reply, sizeof(reply), "{\"type\":\"error\",\"message\":\"%s\"}",
+                      valid ? "IR queue full or value out of range" : "unknown command or value out of range");
+  }
+  else if (sendsIr)
+  {
+    length = snprintf(reply, sizeof(reply), "{\"type\":\"queued\",\"id\":%lu}", (unsigned long)id);
+  }
+  else
+  {
+    return;
+  }
+  webSocketSend(socket, reply, length);
+}
+
+// Hands what the tasks posted to the batch streams and every WebSocket client. State changes that
+// piled up go out once. False if there was nothing.
+bool pushEvents()
+{
+  bool stateChanged = false;
+  bool pushed = false;
+  Event event;
+  while (eventReceive(event))
+  {
+    pushed = true;
+    batchProgress(event);
+    char json[48];
+    int length;
+    switch (event.type)
+    {
+    case EVENT_STATE:
+      stateChanged = true;
+      continue;
+    case EVENT_JOB_FIRED:
+      length = snprintf(json, sizeof(json), "{\"type\":\"fired\",\"job\":%lu}", (unsigned long)event.value);
       break;
-    case 1:
-      if (millis() > nextMillisTask)
-      {
-        nextMillisTask = millis() + millisDelayTask;
-        Serial.println("Sending delay");
-        irsend.sendPronto(numberBTNs[channelTask], NUMBER_OF_REPEATS);
-      }
+    case EVENT_IR_SENT:
+      length = snprintf(json, sizeof(json), "{\"type\":\"sent\",\"id\":%lu}", (unsigned long)event.value);
       break;
-    case 2:
-      if (millis() > nextMillisTask)
-      {
-        nextMillisTask = millis() + random(300000, 360000);
-        Serial.println("Sending random");
-        irsend.sendPronto(numberBTNs[channelTask], NUMBER_OF_REPEATS);
-      }
+    case EVENT_BATCH_STEP:
+      length = snprintf(json, sizeof(json), "{\"type\":\"step\",\"id\":%lu,\"step\":%u}",
+                        (unsigned long)event.value, event.step);
       break;
-    default:
+    case EVENT_IR_COALESCED:
+      length = snprintf(json, sizeof(json), "{\"type\":\"coalesced\",\"id\":%lu}", (unsigned long)event.value);
       break;
+    default:
+      continue;
+    }
+    webSocketBroadcast(json, length);
+  }
+  if (stateChanged)
+  {
+    char json[128];
+    webSocketBroadcast(json, stateJson(json, sizeof(json), "\"type\":\"state\","));
+  }
+  return pushed;
+}
+
+struct Route
+{
+  const char *method;
+  const char *path;
+  void (*handler)(WiFiClient &client, const HttpRequest &request);
+};
+
+const Route routes[] = {
+    {"GET", "/", handlePage},
+    {"GET", "/state", handleState},
+    {"GET", "/boot", handleBoot},
+    {"GET", "/ws", handleWebSocket},
+    {"POST", "/batch", handleBatch},
+    {"GET", "/mode/Modeoff", handleModeOff},
+    {"GET", "/mode/Pwr", handlePower},
+    {"GET", "/mode/JumpDelay", handleJumpDelay},
+    {"GET", "/mode/JumpRandom", handleJumpRandom},
+    {"GET", "/favoriteNumber", handleFavoriteNumber},
+    {"GET", "/delayNumber", handleDelayNumber},
+    {"GET", "/setChannel", handleSetChannel},
+    {"GET", "/setFave", handleSetFave},
+    {"GET", "/key/*", handleKey},
+    {"GET", "/release", handleRelease},
+    {"GET", "/keys", handleKeys},
+    {"GET", "/irStatus", handleIrStatus},
+    {"GET", "/planner", handlePlanner},
+    {"GET", "/planner/channel", handlePlannerChannel},
+    {"GET", "/planner/favorite", handlePlannerFavorite},
+    {"GET", "/schedule", handleSchedule},
+    {"GET", "/schedule/add", handleScheduleAdd},
+    {"GET", "/schedule/remove", handleScheduleRemove},
+    {"GET", "/macro", handleMacros},
+    {"GET", "/macro/define", handleMacroDefine},
+    {"GET", "/macro/run", handleMacroRun},
+    {"GET", "/macro/delete", handleMacroDelete},
+    {"GET", "/metrics", handleMetrics},
+};
+
+const size_t ROUTE_COUNT = sizeof(routes) / sizeof(routes[0]);
+const size_t ROUTE_PAGE = ROUTE_COUNT;         // Any other path, answered with the page
+const size_t ROUTE_REJECTED = ROUTE_COUNT + 1; // 400, 414 and 431
+
+// From accepting a connection until it is closed, indexed like routes[]
+LatencyHistogram routeLatency[ROUTE_COUNT + 2];
+
+// A path ending in '*' matches everything starting with the part before it
+bool routeMatches(const char *route, const char *path)
+{
+  size_t length = strlen(route);
+  if (length > 0 && route[length - 1] == '*')
+  {
+    return strncmp(path, route, length - 1) == 0;
+  }
+  return strcmp(path, route) == 0;
+}
+
+// Runs the handler of the matching route, any other request just gets the page. Returns the route index.
+size_t dispatch(WiFiClient &client, const HttpRequest &request)
+{
+  for (size_t i = 0; i < ROUTE_COUNT; i++)
+  {
+    if (routeMatches(routes[i].path, request.path) && strcmp(request.method, routes[i].method) == 0)
+    {
+      routes[i].handler(client, request);
+      return i;
     }
   }
+  handlePage(client, request);
+  return ROUTE_PAGE;
+}
+
+void writeHttpMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_http_request_duration_seconds", "histogram",
+                     "Time from accepting a connection until it is closed.");
+  for (size_t i = 0; i < ROUTE_COUNT + 2; i++)
+  {
+    char labels[48];
+    const char *route = i < ROUTE_COUNT ? routes[i].path : i == ROUTE_PAGE ? "other" : "rejected";
+    snprintf(labels, sizeof(labels), "route=\"%s\"", route);
+    metricsWriteHistogram(out, "sirius_http_request_duration_seconds", labels, routeLatency[i]);
+  }
+}
+
+void sendError(WiFiClient &client, const char *status)
+{
+  client.print("HTTP/1.1 ");
+  client.println(status);
+  client.println("Connection: close");
+  client.println();
+}
+
+// The page is the same for everybody and lives in flash as complete responses (see page.h),
+// a browser holding the current version gets a 304 instead
+void handlePage(WiFiClient &client, const HttpRequest &request)
+{
+  if (strstr(request.ifNoneMatch, PAGE_ETAG) != nullptr)
+  {
+    client.write(pageNotModifiedResponse, sizeof(pageNotModifiedResponse));
+  }
+  else if (request.acceptsGzip)
+  {
+    client.write(pageGzipResponse, sizeof(pageGzipResponse));
+  }
+  else
+  {
+    client.write(pagePlainResponse, sizeof(pagePlainResponse));
+  }
+}
+
+// Answer to the links and forms of the page when scripts are off, the page reloads from cache
+void redirectToPage(WiFiClient &client)
+{
+  client.print("HTTP/1.1 303 See Other\r\nLocation: /\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+}
+
+// Gets each request from httpServer.cpp once it is complete or rejected
+void serveRequest(WiFiClient &client, const HttpRequest &request, HttpParseResult result, int64_t acceptedMicros)
+{
+  size_t route = ROUTE_REJECTED;
+  switch (result)
+  {
+  case HTTP_PARSE_DONE:
+  {
+    char line[LOG_MAX_TEXT];
+    snprintf(line, sizeof(line), "%s %s", request.method, request.path);
+    logWriteText(LOG_LEVEL_INFO, "%s", line);
+    route = dispatch(client, request);
+    bootMark(BOOT_FIRST_REQUEST);
+    break;
+  }
+  case HTTP_PARSE_URI_TOO_LONG:
+    sendError(client, "414 URI Too Long");
+    break;
+  case HTTP_PARSE_HEADERS_TOO_LARGE:
+    sendError(client, "431 Request Header Fields Too Large");
+    break;
+  case HTTP_PARSE_BODY_TOO_LARGE:
+    sendError(client, "413 Content Too Large");
+    break;
+  default:
+    sendError(client, "400 Bad Request");
+    break;
+  }
+  // The connection is closed right after this returns
+  routeLatency[route].observe(esp_timer_get_time() - acceptedMicros);
+}
+
+// Brings up the access point and the listener, then serves HTTP connections and WebSocket
+// clients, all polled without blocking so none of them can hold up the others. Sleeps whenever a
+// pass found nothing to do, a tick while busy and longer once idle (see lowPower.h), woken early
+// by events to push.
+void serverTask(void *parameter)
+{
+  logWrite(LOG_LEVEL_INFO, "Setting AP (Access Point)…");
+  // Remove the password parameter, if you want the AP (Access Point) to be open
+  WiFi.softAP(ssid, password);
+
+  IPAddress IP = WiFi.softAPIP();
+  logWriteText(LOG_LEVEL_INFO, "AP IP address: %s", IP.toString().c_str());
+  bootMark(BOOT_AP_UP);
+
+  httpServerBegin(80);
+  bootMark(BOOT_SERVER_LISTENING);
+
+  // Handlers queue IR commands and read the settings, connections wait in the backlog until
+  // setup() has both ready
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  while (1)
+  {
+    bool worked = httpServerPoll(serveRequest);
+    worked |= webSocketPoll(handleSocketCommand);
+    worked |= pushEvents();
+    worked |= settingsPoll();
+    lowPowerServerPass(worked);
+  }
 }
-void sendCommand()
+
+// Everything runs in tasks pinned to their core, the loop task is not needed
+void loop()
 {
-  Serial.println("Sending from normal memory");
-  irsend.sendPronto(ChannelDownBTN, NUMBER_OF_REPEATS);
-}
\ No newline at end of file
+  vTaskDelete(NULL);
+}
@@ -0,0 +1,122 @@
+#include "metrics.h"
+
+void LatencyHistogram::observe(uint32_t micros)
+{
+  size_t bucket = 0;
+  while (bucket < METRICS_BUCKETS && micros > metricsBucketMicros[bucket])
+  {
+    bucket++;
+  }
+  buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  sumMicros.fetch_add(micros, std::memory_order_relaxed);
+}
+
+size_t MetricsBuffer::write(const uint8_t *buffer, size_t size)
+{
+  size_t left = size;
+  while (left > 0)
+  {
+    size_t part = left < METRICS_CHUNK_BYTES - used ? left : METRICS_CHUNK_BYTES - used;
+    memcpy(chunk + used, buffer, part);
+    used += part;
+    buffer += part;
+    left -= part;
+    if (used == METRICS_CHUNK_BYTES)
+    {
+      flush();
+    }
+  }
+  return size;
+}
+
+void MetricsBuffer::flush()
+{
+  if (used > 0)
+  {
+    out.write(chunk, used);
+    used = 0;
+  }
+}
+
+void metricsWriteFamily(Print &out, const char *name, const char *type, const char *help)
+{
+  out.print("# HELP ");
+  out.print(name);
+  out.print(" ");
+  out.print(help);
+  out.print('\n');
+  out.print("# TYPE ");
+  out.print(name);
+  out.print(" ");
+  out.print(type);
+  out.print('\n');
+}
+
+static void writeName(Print &out, const char *name, const char *suffix, const char *labels)
+{
+  out.print(name);
+  out.print(suffix);
+  if (*labels != '\0')
+  {
+    out.print("{");
+    out.print(labels);
+    out.print("}");
+  }
+  out.print(" ");
+}
+
+void metricsWriteSample(Print &out, const char *name, const char *labels, uint32_t value)
+{
+  writeName(out, name, "", labels);
+  out.print(value);
+  out.print('\n');
+}
+
+// Seconds with microsecond resolution without going through floating point
+static void printSeconds(Print &out, uint64_t micros)
+{
+  char text[24];
+  snprintf(text, sizeof(text), "%llu.%06lu", (unsigned long long)(micros / 1000000), (unsigned long)(micros % 1000000));
+  out.print(text);
+}
+
+void metricsWriteSeconds(Print &out, const char *name, const char *labels, uint64_t micros)
+{
+  writeName(out, name, "", labels);
+  printSeconds(out, micros);
+  out.print('\n');
+}
+
+void metricsWriteHistogram(Print &out, const char *name, const char *labels, const LatencyHistogram &histogram)
+{
+  uint32_t cumulative = 0;
+  for (size_t bucket = 0; bucket <= METRICS_BUCKETS; bucket++)
+  {
+    cumulative += histogram.buckets[bucket].load(std::memory_order_relaxed);
+    out.print(name);
+    out.print("_bucket{");
+    if (*labels != '\0')
+    {
+      out.print(labels);
+      out.print(",");
+    }
+    out.print("le=\"");
+    if (bucket < METRICS_BUCKETS)
+    {
+      printSeconds(out, metricsBucketMicros[bucket]);
+    }
+    else
+    {
+      out.print("+Inf");
+    }
+    out.print("\"} ");
+    out.print(cumulative);
+    out.print('\n');
+  }
+  writeName(out, name, "_sum", labels);
+  printSeconds(out, histogram.sumMicros.load(std::memory_order_relaxed));
+  out.print('\n');
+  writeName(out, name, "_count", labels);
+  out.print(cumulative);
+  out.print('\n');
+}
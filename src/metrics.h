@@ -0,0 +1,64 @@
+/*
+ *  metrics.h
+ *
+ *  Counters and latency histograms for the /metrics endpoint, written out in the Prometheus
+ *  text format. Recording is a few relaxed atomic increments of 32 bit counters, which are
+ *  lock-free on the ESP32, so instrumented paths never wait for a scrape or for each other.
+ *  A scrape reads the counters one by one and may see a bucket a moment ahead of the sum.
+ *  Lines end in a bare \n, Prometheus does not accept the \r\n of println().
+ *
+ *  Sums are kept in 32 bit microseconds and wrap after about 71 minutes of summed latency,
+ *  Prometheus' rate() takes that for a counter reset.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+#include <atomic>
+
+#define METRICS_BUCKETS 12
+#define METRICS_CHUNK_BYTES 1436 // One TCP segment, the MSS of the ESP32's lwIP
+
+// Upper bounds in microseconds, from half a millisecond to the length of a long macro
+constexpr uint32_t metricsBucketMicros[METRICS_BUCKETS] = {500,    1000,   2500,   5000,   10000,   25000,
+                                                           50000,  100000, 250000, 500000, 1000000, 2500000};
+
+struct LatencyHistogram
+{
+  std::atomic<uint32_t> buckets[METRICS_BUCKETS + 1]; // Not cumulative, the last one is +Inf
+  std::atomic<uint32_t> sumMicros;
+
+  void observe(uint32_t micros);
+};
+
+// Writes "# HELP" and "# TYPE" of a metric family, once before its samples
+void metricsWriteFamily(Print &out, const char *name, const char *type, const char *help);
+
+// Writes the _bucket, _sum and _count samples, labels is "" or like "route=\"/\""
+void metricsWriteHistogram(Print &out, const char *name, const char *labels, const LatencyHistogram &histogram);
+
+void metricsWriteSample(Print &out, const char *name, const char *labels, uint32_t value);
+void metricsWriteSeconds(Print &out, const char *name, const char *labels, uint64_t micros);
+
+// Collects the many small prints of a scrape and passes them on in METRICS_CHUNK_BYTES writes.
+// With TCP_NODELAY every print() to a WiFiClient would be a segment of its own. Whatever is
+// left is written by flush() or when the buffer goes out of scope.
+class MetricsBuffer : public Print
+{
+public:
+  explicit MetricsBuffer(Print &out) : out(out) {}
+  ~MetricsBuffer() { flush(); }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  void flush() override; // Does not flush out, WiFiClient::flush() discards received data
+
+private:
+  Print &out;
+  uint8_t chunk[METRICS_CHUNK_BYTES];
+  size_t used = 0;
+};
+
+#endif // METRICS_H
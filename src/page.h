@@ -0,0 +1,530 @@
+/*
+ *  page.h
+ *
+ *  Generated by tools/embedPage.py from web/index.html, edit the page and rebuild instead.
+ *  5547 bytes of HTML, 2057 gzipped.
+ */
+#ifndef PAGE_H
+#define PAGE_H
+
+#include <stdint.h>
+
+#define PAGE_ETAG "\"fbe1ba87c83fad70\""
+
+// 200 with the gzipped page, for clients sending Accept-Encoding: gzip
+const uint8_t pageGzipResponse[2255] = {
+    0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d,
+    0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74,
+    0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65,
+    0x74, 0x3d, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x0d,
+    0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a,
+    0x20, 0x32, 0x30, 0x35, 0x37, 0x0d, 0x0a, 0x45, 0x54, 0x61, 0x67, 0x3a, 0x20, 0x22, 0x66, 0x62,
+    0x65, 0x31, 0x62, 0x61, 0x38, 0x37, 0x63, 0x38, 0x33, 0x66, 0x61, 0x64, 0x37, 0x30, 0x22, 0x0d,
+    0x0a, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20,
+    0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0x0d, 0x0a, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20,
+    0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x0d,
+    0x0a, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6c, 0x6f,
+    0x73, 0x65, 0x0d, 0x0a, 0x0d, 0x0a, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
+    0xad, 0x58, 0x6d, 0x6f, 0xdc, 0x36, 0x12, 0xfe, 0xbe, 0xbf, 0x62, 0xa2, 0x03, 0x8a, 0x5d, 0xd4,
+    0xab, 0xb5, 0xd3, 0xf6, 0x70, 0xf0, 0xbe, 0x1c, 0x52, 0xc7, 0xbe, 0xb6, 0x68, 0x63, 0x23, 0x4e,
+    0x11, 0x1c, 0x0e, 0xf7, 0x81, 0x2b, 0x71, 0x57, 0xac, 0x29, 0x51, 0x25, 0x29, 0x6f, 0xb7, 0x81,
+    0xff, 0xfb, 0x3d, 0x43, 0x51, 0xfb, 0xee, 0x24, 0x57, 0x24, 0x40, 0x6b, 0x8b, 0x9c, 0x19, 0xce,
+    0x33, 0x7c, 0xe6, 0x85, 0x9e, 0xbc, 0x78, 0x7d, 0x7b, 0xf5, 0xee, 0xdf, 0x77, 0xd7, 0x54, 0xf8,
+    0x52, 0xcf, 0x26, 0xe1, 0xff, 0xbd, 0x49, 0x21, 0x45, 0x3e, 0x9b, 0x94, 0xd2, 0x0b, 0xaa, 0x44,
+    0x29, 0xa7, 0xc9, 0xa3, 0x92, 0xab, 0xda, 0x58, 0x9f, 0x50, 0x66, 0x2a, 0x2f, 0x2b, 0x3f, 0x4d,
+    0x56, 0x2a, 0xf7, 0xc5, 0x34, 0x97, 0x8f, 0x2a, 0x93, 0xc3, 0xf0, 0x71, 0x46, 0xaa, 0x52, 0x5e,
+    0x09, 0x3d, 0x74, 0x99, 0xd0, 0x72, 0x7a, 0x91, 0xc0, 0x94, 0x56, 0xd5, 0x03, 0x59, 0xa9, 0xa7,
+    0x89, 0x82, 0x6a, 0x42, 0x85, 0x95, 0x8b, 0x69, 0x92, 0x0b, 0x2f, 0x2e, 0xcf, 0x78, 0xff, 0xc5,
+    0x70, 0x48, 0xf7, 0xd2, 0x3e, 0xca, 0x9c, 0x6a, 0x2b, 0x87, 0xcb, 0x3f, 0x55, 0x5d, 0xe3, 0xf7,
+    0x85, 0x35, 0x25, 0x2d, 0xb4, 0x70, 0xb0, 0xea, 0x8d, 0xd1, 0x6e, 0x24, 0xcb, 0xb9, 0xcc, 0xef,
+    0xc4, 0x52, 0xa6, 0xf5, 0x9a, 0x7c, 0x63, 0x2b, 0x47, 0xbe, 0x50, 0x8e, 0x16, 0x4a, 0x4b, 0x1c,
+    0xec, 0x0d, 0x39, 0x9b, 0x8d, 0x6a, 0x16, 0x28, 0x68, 0x38, 0x84, 0x69, 0xe7, 0xd7, 0x5a, 0xce,
+    0x18, 0x12, 0x7d, 0xa0, 0x05, 0xfc, 0x1e, 0x2e, 0x44, 0xa9, 0xf4, 0xfa, 0x92, 0x7e, 0x90, 0xfa,
+    0x51, 0x7a, 0x95, 0x89, 0x31, 0xe5, 0xca, 0xd5, 0x5a, 0x60, 0x4d, 0x55, 0x70, 0x55, 0x0e, 0xe7,
+    0xda, 0x64, 0x0f, 0x63, 0x2a, 0x85, 0x5d, 0xaa, 0xea, 0x92, 0xce, 0xeb, 0x3f, 0x48, 0x34, 0xde,
+    0x8c, 0xc9, 0xcb, 0x3f, 0xfc, 0x50, 0x68, 0xb5, 0xc4, 0x6a, 0x86, 0x08, 0x48, 0x3b, 0x7e, 0xea,
+    0xa5, 0xf3, 0xc6, 0x7b, 0x53, 0xc1, 0xfe, 0x5c, 0x64, 0x0f, 0x4b, 0x6b, 0x9a, 0x2a, 0x1f, 0x66,
+    0x46, 0x1b, 0x7b, 0x49, 0x7f, 0xfb, 0xf6, 0xea, 0xd5, 0xcd, 0x77, 0xe7, 0x63, 0x9a, 0x1b, 0x9b,
+    0x4b, 0x2c, 0x54, 0xa6, 0x92, 0x63, 0x8a, 0xbb, 0xab, 0x42, 0x79, 0x7c, 0xd5, 0x22, 0xcf, 0x55,
+    0xb5, 0xbc, 0xa4, 0x8b, 0xbf, 0xe3, 0xa4, 0x6f, 0x71, 0xdc, 0xb8, 0x17, 0x4e, 0xca, 0x65, 0x66,
+    0xac, 0xf0, 0xca, 0x54, 0x9d, 0x62, 0x40, 0xe0, 0xd4, 0x9f, 0xf2, 0x92, 0xbe, 0x61, 0xb9, 0x8d,
+    0x8f, 0x2f, 0xf9, 0x23, 0x6b, 0xac, 0x63, 0xbb, 0xb5, 0x51, 0xfb, 0xbe, 0xbd, 0xa4, 0x0f, 0x27,
+    0x7c, 0xfb, 0x2e, 0xfc, 0x63, 0xa9, 0x07, 0xb9, 0x3e, 0xed, 0x7e, 0x14, 0xf9, 0x4c, 0xf7, 0xe1,
+    0x44, 0xc0, 0x10, 0x03, 0x75, 0xe4, 0x7e, 0xef, 0x99, 0x40, 0xef, 0xa0, 0xba, 0xf8, 0xc7, 0x11,
+    0xaa, 0xc6, 0x49, 0x3b, 0x74, 0x52, 0xcb, 0xcc, 0x77, 0x0e, 0x0c, 0x57, 0x72, 0xfe, 0xa0, 0xfc,
+    0xd0, 0x9b, 0x26, 0x2b, 0x86, 0x20, 0x9a, 0x36, 0x4d, 0xb7, 0xf9, 0x34, 0x19, 0xb5, 0x97, 0x3e,
+    0x19, 0x05, 0x0a, 0xf7, 0x26, 0x73, 0x93, 0xaf, 0x41, 0xeb, 0x8b, 0xd9, 0xbd, 0xb2, 0x56, 0x35,
+    0x0e, 0x1b, 0x17, 0xb3, 0x5e, 0x6f, 0x52, 0xcf, 0xae, 0x1a, 0x6b, 0x71, 0x8d, 0xf4, 0x8b, 0xc9,
+    0x71, 0xf6, 0xc4, 0xd5, 0xa2, 0x22, 0x95, 0x4f, 0x93, 0x12, 0xdf, 0x09, 0x0c, 0xf0, 0x02, 0x7e,
+    0xd4, 0xb3, 0x5d, 0xe1, 0x1b, 0xf1, 0x68, 0x2c, 0x90, 0x77, 0x0a, 0x19, 0x18, 0xea, 0xa6, 0xc9,
+    0x22, 0x2e, 0x3f, 0xab, 0x97, 0xcb, 0x00, 0x7d, 0x7b, 0x4a, 0x58, 0xd8, 0x17, 0xef, 0x4d, 0x16,
+    0xc6, 0x96, 0x24, 0x32, 0x8e, 0xda, 0x34, 0x19, 0x75, 0x46, 0xdf, 0x34, 0x60, 0xbe, 0x4d, 0x08,
+    0xe9, 0x58, 0x18, 0xa8, 0x2e, 0x25, 0xd2, 0x90, 0x13, 0x08, 0x37, 0x55, 0x96, 0xa2, 0xca, 0x77,
+    0xcf, 0x47, 0xc2, 0x89, 0xb9, 0xd4, 0x08, 0xab, 0xdd, 0x2e, 0xb7, 0x16, 0x7e, 0xac, 0xea, 0xc6,
+    0x27, 0xb3, 0x6b, 0xa6, 0x07, 0x89, 0x2d, 0x94, 0xc9, 0x28, 0xa8, 0x40, 0x55, 0xb1, 0x04, 0xf9,
+    0x75, 0x8d, 0x8c, 0xe7, 0x5b, 0x4c, 0x82, 0xab, 0xa7, 0xac, 0xc4, 0xb2, 0x70, 0x72, 0xcb, 0xca,
+    0xdf, 0x1b, 0x65, 0x65, 0x7e, 0x60, 0xd0, 0x35, 0xf3, 0x52, 0x61, 0xfb, 0x51, 0xe8, 0x06, 0x9f,
+    0xf7, 0xed, 0x27, 0x84, 0x46, 0x0c, 0x7b, 0x76, 0x88, 0x3e, 0x04, 0xe8, 0x33, 0xa0, 0xc7, 0x40,
+    0xee, 0xe1, 0xde, 0xd1, 0x3d, 0x00, 0x1d, 0x76, 0xfa, 0x4e, 0x66, 0x83, 0x4f, 0xc2, 0x3e, 0x32,
+    0x12, 0x31, 0x1f, 0xaf, 0xff, 0x45, 0xc0, 0xcc, 0x8f, 0x89, 0x88, 0x05, 0x71, 0xc4, 0xb4, 0x1b,
+    0xfd, 0xd4, 0x94, 0xf5, 0xeb, 0x00, 0xe8, 0x00, 0x25, 0xef, 0x52, 0xc7, 0x99, 0x58, 0x73, 0x22,
+    0xf7, 0xda, 0xaf, 0x64, 0xf6, 0x1b, 0x74, 0x5b, 0x11, 0x14, 0x4c, 0xea, 0x6e, 0xe6, 0x93, 0x3c,
+    0x6d, 0xd5, 0xf1, 0x8b, 0xd8, 0x90, 0xf6, 0x84, 0x53, 0x6f, 0xe1, 0x85, 0x29, 0x4f, 0x7a, 0x65,
+    0xdb, 0xad, 0x8f, 0xba, 0xd5, 0xca, 0x7c, 0x61, 0xbf, 0x38, 0x71, 0xcd, 0x62, 0x71, 0xd2, 0x29,
+    0x5e, 0x7f, 0xce, 0xa3, 0x5f, 0x6e, 0x5f, 0x5f, 0xd3, 0xed, 0xcd, 0xcd, 0xf1, 0x19, 0x87, 0x1c,
+    0x74, 0xd2, 0x5f, 0x15, 0xa2, 0xaa, 0xa4, 0xfe, 0x28, 0x05, 0xb3, 0x28, 0xb3, 0x4f, 0xc2, 0xad,
+    0x72, 0xe4, 0xe0, 0xbf, 0xcc, 0x3b, 0x43, 0x71, 0xe9, 0x93, 0xec, 0x3b, 0xd4, 0x8e, 0xe4, 0x3b,
+    0x5a, 0xfe, 0x32, 0xc9, 0x06, 0xb3, 0x28, 0x07, 0xf2, 0x53, 0x35, 0x46, 0x1e, 0x43, 0x64, 0xb5,
+    0x5d, 0x7c, 0x9f, 0x5d, 0x55, 0xf6, 0x74, 0xb7, 0xe8, 0x76, 0xd6, 0xbe, 0x5c, 0x5a, 0xdd, 0xad,
+    0xec, 0x21, 0x9a, 0xda, 0xac, 0x50, 0x58, 0x9e, 0xa3, 0xc8, 0xdd, 0xed, 0xfb, 0xeb, 0xb7, 0xa7,
+    0xf8, 0x91, 0x63, 0x24, 0x52, 0xda, 0x05, 0x04, 0x56, 0x96, 0x26, 0x50, 0xd6, 0x35, 0x30, 0x6a,
+    0xd7, 0xb3, 0x57, 0x5a, 0x13, 0xba, 0x29, 0x7a, 0x4c, 0xb7, 0x32, 0xa9, 0x83, 0x24, 0x2f, 0x26,
+    0xc1, 0xc4, 0x64, 0x14, 0x2d, 0xb0, 0x31, 0x97, 0x59, 0x55, 0xfb, 0x59, 0x6f, 0x34, 0xa2, 0x77,
+    0x85, 0x24, 0x1e, 0x5d, 0xa8, 0x92, 0x8f, 0x28, 0x54, 0xcc, 0xa8, 0xa5, 0x74, 0x18, 0x7d, 0xb0,
+    0x9e, 0xc5, 0x1e, 0x12, 0x00, 0x3b, 0x12, 0x16, 0xa2, 0x8d, 0x2b, 0x30, 0x24, 0x99, 0xc7, 0x50,
+    0xd4, 0xde, 0xcb, 0xf9, 0x3d, 0x7a, 0xa9, 0xf4, 0x04, 0x24, 0xa3, 0x15, 0xd4, 0xd0, 0x9d, 0xb3,
+    0x82, 0x84, 0x76, 0x86, 0x8d, 0x67, 0x02, 0xad, 0x4f, 0xba, 0xd6, 0x58, 0x1b, 0x00, 0xc8, 0x38,
+    0x43, 0x06, 0x2b, 0x96, 0xea, 0x02, 0xad, 0xd3, 0x91, 0x93, 0x92, 0xf8, 0xf0, 0x75, 0x3c, 0x9d,
+    0xac, 0x5a, 0x16, 0x9e, 0xc4, 0x4a, 0xac, 0x53, 0xfa, 0xb5, 0xf2, 0x4a, 0x07, 0x03, 0xae, 0x3d,
+    0x09, 0x83, 0x97, 0xa9, 0x65, 0xc5, 0xe6, 0x7d, 0xe7, 0x3b, 0x9a, 0xb5, 0x23, 0x34, 0x60, 0x81,
+    0xf4, 0xc6, 0x19, 0xed, 0x86, 0x16, 0xaa, 0x22, 0x1e, 0x02, 0x5d, 0x4a, 0xef, 0x15, 0xd8, 0x85,
+    0x8b, 0x6c, 0x81, 0x87, 0xfd, 0xb0, 0x13, 0xa4, 0xf9, 0xf6, 0xe0, 0x05, 0xce, 0xd1, 0xb4, 0x32,
+    0xf6, 0x21, 0x80, 0x67, 0xfb, 0x8e, 0xa7, 0x43, 0xe0, 0xac, 0x1c, 0xae, 0x2c, 0xa0, 0x28, 0x69,
+    0x05, 0x4b, 0x40, 0x0e, 0x76, 0x80, 0x21, 0x99, 0x0f, 0xe3, 0x0b, 0x97, 0x97, 0x30, 0x11, 0x86,
+    0x19, 0xb0, 0xb7, 0x68, 0xaa, 0x40, 0x6f, 0x72, 0x85, 0x59, 0xf5, 0x83, 0x57, 0x03, 0xfa, 0xd0,
+    0x23, 0xca, 0x4d, 0xd6, 0x94, 0x08, 0x68, 0x0a, 0x92, 0x5f, 0x6b, 0xc9, 0xbf, 0x7e, 0xbf, 0xfe,
+    0x31, 0xef, 0xb7, 0x9d, 0x7f, 0x90, 0x32, 0x47, 0xaf, 0xda, 0x29, 0x97, 0xa6, 0x14, 0x14, 0x53,
+    0xde, 0x1a, 0x7f, 0x4c, 0xb7, 0xad, 0xcd, 0xa7, 0x95, 0xc3, 0x1e, 0x6b, 0x03, 0x22, 0xf5, 0x31,
+    0x05, 0x3b, 0x4f, 0xb2, 0x55, 0x46, 0xa1, 0x3a, 0x65, 0xd3, 0x7d, 0xbf, 0xbe, 0x62, 0x46, 0xbe,
+    0x41, 0x5a, 0xf4, 0xb7, 0xd5, 0x71, 0xd0, 0x02, 0xa0, 0x4e, 0xfb, 0xe4, 0x69, 0x9d, 0x34, 0x1f,
+    0xf8, 0xd4, 0x7b, 0xea, 0x6d, 0x03, 0x81, 0x8c, 0xb0, 0xd2, 0x15, 0xfd, 0xd6, 0xca, 0x42, 0xfa,
+    0xac, 0xe8, 0x27, 0xed, 0x7d, 0xb1, 0xe7, 0x85, 0xac, 0xfa, 0xd8, 0xaf, 0xe1, 0x9f, 0xa4, 0xe9,
+    0x8c, 0xba, 0xdf, 0xd3, 0xdf, 0x9c, 0xa9, 0xfa, 0x83, 0x28, 0xc1, 0xd1, 0x1c, 0x8c, 0xd9, 0xae,
+    0x06, 0x0d, 0x22, 0x1b, 0xa6, 0x54, 0x35, 0x5a, 0x8f, 0x77, 0xce, 0x02, 0xca, 0x0a, 0x17, 0x13,
+    0xcf, 0xda, 0x8a, 0xc9, 0xd5, 0x96, 0xae, 0xfd, 0x64, 0xe5, 0x2e, 0x47, 0xa3, 0x84, 0xbe, 0x26,
+    0xcc, 0x82, 0x61, 0x58, 0x4c, 0x0b, 0x83, 0xe0, 0x7c, 0x4d, 0x09, 0x68, 0x9c, 0x0c, 0xc6, 0x1b,
+    0xd5, 0xd4, 0x54, 0xa5, 0x74, 0x8e, 0x59, 0x36, 0x65, 0x96, 0x32, 0xde, 0x59, 0x0c, 0x46, 0x1b,
+    0xd0, 0xed, 0xf6, 0x4f, 0xf7, 0xb7, 0x6f, 0xd2, 0x5a, 0x58, 0x27, 0xfb, 0x41, 0x32, 0xe5, 0xcc,
+    0x0f, 0xb6, 0x88, 0xd4, 0x82, 0xfa, 0x51, 0x32, 0xe5, 0x72, 0x42, 0xd3, 0x29, 0x25, 0x31, 0x02,
+    0xd1, 0x1c, 0xb5, 0x84, 0x89, 0x52, 0x51, 0xef, 0x89, 0x83, 0xb9, 0xe7, 0x4e, 0xa6, 0x0d, 0x87,
+    0x89, 0x80, 0x70, 0xe3, 0xc9, 0x41, 0x34, 0xc2, 0x92, 0xf4, 0xef, 0x54, 0x29, 0xc1, 0xfa, 0x7e,
+    0x0c, 0xc9, 0x19, 0xbd, 0x3c, 0x3f, 0x3f, 0x0f, 0x76, 0x9f, 0xc6, 0xfb, 0xf7, 0xd3, 0x54, 0xfd,
+    0xc6, 0xea, 0xb3, 0x2e, 0x49, 0x5b, 0x8f, 0xd8, 0xe5, 0x68, 0xf8, 0xab, 0xaf, 0xba, 0xf3, 0x2d,
+    0xa6, 0xdb, 0xf5, 0x7d, 0xc8, 0x34, 0x20, 0xd8, 0x44, 0x34, 0xbd, 0xbd, 0xbb, 0x7e, 0x33, 0xd8,
+    0xf3, 0x26, 0x75, 0xb2, 0xca, 0xfb, 0x9d, 0xc5, 0x70, 0x2a, 0xe8, 0x03, 0xd7, 0x5b, 0xa1, 0x96,
+    0x05, 0xe1, 0xd4, 0x0f, 0x5d, 0x36, 0x5d, 0x52, 0x02, 0xe1, 0x46, 0xe8, 0xe4, 0x69, 0x43, 0x8b,
+    0xc0, 0x9c, 0xc1, 0x86, 0x53, 0x48, 0xcb, 0xeb, 0x50, 0x2b, 0xf8, 0xf5, 0x00, 0x0e, 0x73, 0x2a,
+    0xb7, 0xf5, 0xb0, 0xad, 0x59, 0x5c, 0xcf, 0x1d, 0xe3, 0x90, 0xed, 0x4b, 0x6e, 0xc4, 0x25, 0x30,
+    0xec, 0x2c, 0x94, 0xc5, 0x6d, 0x79, 0xc4, 0x24, 0xe6, 0xbf, 0xdb, 0x14, 0x13, 0x99, 0xf7, 0x9e,
+    0xcd, 0xaf, 0x58, 0x6c, 0x07, 0x29, 0x1e, 0x1c, 0xd7, 0x7c, 0xab, 0x3f, 0x43, 0x11, 0x2a, 0xb6,
+    0x9f, 0x78, 0xb3, 0x5c, 0x6a, 0x99, 0x9c, 0xed, 0x5c, 0x45, 0x4b, 0x89, 0x70, 0xe6, 0xf4, 0xf9,
+    0x9c, 0x0d, 0x65, 0x39, 0x60, 0xe2, 0x18, 0xf3, 0x57, 0x9a, 0x15, 0x4a, 0xe7, 0x51, 0xe8, 0x0a,
+    0xaf, 0x21, 0xcf, 0xe1, 0x3d, 0x1f, 0xec, 0x05, 0x2b, 0x19, 0xb5, 0x8a, 0x9f, 0x9b, 0x31, 0x6d,
+    0x2c, 0x36, 0x24, 0xd9, 0x2b, 0x03, 0xbc, 0xc7, 0xf1, 0x0b, 0x32, 0x5b, 0x06, 0x76, 0x08, 0xc2,
+    0xe3, 0x79, 0x07, 0x41, 0x86, 0x7b, 0xf7, 0x32, 0xfa, 0xd7, 0x4f, 0x44, 0x12, 0xe9, 0xc9, 0xff,
+    0x58, 0x36, 0xcd, 0xba, 0xaa, 0x01, 0x2d, 0xc6, 0x97, 0x1c, 0xec, 0x73, 0x57, 0xe4, 0x2d, 0x86,
+    0x10, 0x12, 0x8f, 0x0f, 0x3e, 0x90, 0xe1, 0x74, 0x01, 0x6d, 0xd3, 0xc8, 0x99, 0x68, 0x89, 0x9e,
+    0x91, 0xde, 0x2f, 0x41, 0xfb, 0x02, 0x21, 0xa4, 0x02, 0xef, 0x79, 0x30, 0x90, 0x85, 0x37, 0xde,
+    0x3e, 0xb5, 0x49, 0xd5, 0xf1, 0x09, 0x3f, 0x99, 0x51, 0x3f, 0x18, 0xcd, 0x8f, 0x49, 0xd4, 0xf5,
+    0x1d, 0x56, 0x05, 0x82, 0x30, 0x87, 0xd1, 0x74, 0x3d, 0x5e, 0xfb, 0x96, 0xc1, 0xc5, 0xee, 0x52,
+    0xa1, 0xe1, 0xe9, 0x35, 0xc2, 0x5e, 0x23, 0x2c, 0x34, 0xc7, 0x0b, 0x18, 0x12, 0x4d, 0x68, 0x55,
+    0x2a, 0xb0, 0x8a, 0x4b, 0xd4, 0xd2, 0x9c, 0x91, 0x08, 0x7d, 0xa4, 0x34, 0x68, 0x78, 0xf4, 0x68,
+    0x34, 0x82, 0x89, 0x91, 0xb4, 0xac, 0x53, 0x7a, 0x23, 0x65, 0xde, 0xf2, 0x72, 0x93, 0x43, 0x67,
+    0xa1, 0xb9, 0x70, 0x9b, 0x82, 0x8d, 0xb6, 0x21, 0xd6, 0xb8, 0x58, 0xc7, 0xf6, 0x04, 0x39, 0x38,
+    0xa8, 0x25, 0x3b, 0x98, 0x86, 0x02, 0x58, 0xc0, 0x67, 0x4e, 0x70, 0xbb, 0xc9, 0xfa, 0x6e, 0x95,
+    0x91, 0x4c, 0x31, 0xef, 0x22, 0xd7, 0xc6, 0x5b, 0x5e, 0x1f, 0xd3, 0x37, 0x3e, 0xd8, 0x73, 0xb3,
+    0xaa, 0xc0, 0xe1, 0xbd, 0xda, 0xb6, 0x47, 0x82, 0xb6, 0x96, 0x79, 0xbc, 0x8e, 0xf9, 0x6e, 0xb8,
+    0xfa, 0x38, 0xa6, 0x00, 0xbf, 0xdf, 0x5b, 0x1a, 0x1c, 0x1d, 0xda, 0xf2, 0x3a, 0xa8, 0x6f, 0x2a,
+    0xc7, 0xff, 0x59, 0x43, 0x76, 0xe1, 0xed, 0x94, 0xb2, 0xdd, 0xa2, 0xb7, 0x7b, 0xb0, 0xb7, 0xcd,
+    0xe6, 0xfa, 0x77, 0xcb, 0x4f, 0xc2, 0x22, 0x81, 0x41, 0x47, 0x9c, 0x41, 0xad, 0xa7, 0x0b, 0x14,
+    0xc4, 0xf3, 0x8e, 0xcb, 0x4f, 0x67, 0xf4, 0x4d, 0x57, 0x1f, 0x03, 0x35, 0x76, 0xfa, 0x97, 0x96,
+    0x60, 0x66, 0xec, 0x29, 0x19, 0x3e, 0x6c, 0xe7, 0xd0, 0xc6, 0xcf, 0x4d, 0x3a, 0x77, 0x4e, 0x6d,
+    0xf0, 0x9e, 0x2a, 0x8b, 0x49, 0x34, 0x99, 0x6c, 0x2a, 0xdb, 0xa7, 0x2f, 0xaa, 0xa9, 0x71, 0x4d,
+    0x51, 0x6f, 0xf0, 0x39, 0x37, 0x9b, 0x89, 0x2a, 0xc3, 0xeb, 0x60, 0x57, 0xe9, 0x63, 0x5a, 0x99,
+    0x56, 0xd9, 0xc3, 0x5f, 0x61, 0xc2, 0xb6, 0x94, 0x85, 0x5c, 0xeb, 0x46, 0x85, 0x20, 0x0c, 0x06,
+    0xf3, 0xcf, 0xd7, 0x72, 0x21, 0x1a, 0x8d, 0xae, 0xbc, 0xed, 0x86, 0x2f, 0x62, 0xa0, 0xb6, 0xc5,
+    0x87, 0xdb, 0x50, 0xb8, 0x26, 0x98, 0x7f, 0xe5, 0xbd, 0x55, 0x18, 0x83, 0x31, 0x85, 0x70, 0xe9,
+    0x48, 0x06, 0x67, 0x27, 0x6b, 0xc4, 0x4e, 0x97, 0x3c, 0xc9, 0xc3, 0xf6, 0x22, 0x3f, 0x02, 0x3a,
+    0x0e, 0xf5, 0x07, 0xa8, 0x9f, 0xf7, 0xbd, 0x8d, 0x47, 0x78, 0xc4, 0xec, 0xc7, 0x83, 0x37, 0x19,
+    0x00, 0x6f, 0x1d, 0x00, 0x68, 0x5f, 0x3b, 0xe8, 0xf3, 0xa0, 0xdc, 0x3f, 0x43, 0x35, 0xc3, 0x30,
+    0xf2, 0xeb, 0xdb, 0x9f, 0xef, 0xc1, 0xa3, 0xac, 0xb8, 0x13, 0xa8, 0x08, 0xae, 0xcf, 0x6b, 0x37,
+    0xd0, 0x7d, 0x0d, 0x80, 0xc1, 0xc8, 0x60, 0x70, 0xb6, 0x2d, 0xdb, 0xe5, 0x51, 0x71, 0x64, 0xfa,
+    0xb2, 0xad, 0xb0, 0xf9, 0x7b, 0x83, 0x6a, 0x71, 0x1f, 0xfe, 0x5a, 0x65, 0x00, 0x2a, 0xbc, 0x5a,
+    0xfe, 0x13, 0x5e, 0x2d, 0xcc, 0xf8, 0xff, 0xa2, 0x65, 0x84, 0x19, 0x9e, 0xc7, 0x27, 0xfc, 0xb7,
+    0x19, 0xc7, 0xc6, 0xbd, 0xcd, 0xb4, 0x34, 0xc6, 0x33, 0xa6, 0x7b, 0x16, 0xe0, 0xfd, 0x11, 0xfe,
+    0x78, 0x35, 0x6a, 0xff, 0x28, 0xfb, 0x3f, 0xfd, 0xb9, 0x1c, 0xdd, 0xab, 0x15, 0x00, 0x00};
+
+// 200 with the page as is
+const uint8_t pagePlainResponse[5721] = {
+    0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d,
+    0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74,
+    0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65,
+    0x74, 0x3d, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x35, 0x35, 0x34, 0x37, 0x0d, 0x0a, 0x45,
+    0x54, 0x61, 0x67, 0x3a, 0x20, 0x22, 0x66, 0x62, 0x65, 0x31, 0x62, 0x61, 0x38, 0x37, 0x63, 0x38,
+    0x33, 0x66, 0x61, 0x64, 0x37, 0x30, 0x22, 0x0d, 0x0a, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43,
+    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x3a, 0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65,
+    0x0d, 0x0a, 0x56, 0x61, 0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x2d, 0x45,
+    0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21,
+    0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c, 0x68, 0x74,
+    0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20,
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64,
+    0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69,
+    0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x22, 0x3e, 0x0a, 0x3c,
+    0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x69, 0x63, 0x6f, 0x6e, 0x22, 0x20,
+    0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x2c, 0x22, 0x3e, 0x0a, 0x3c,
+    0x21, 0x2d, 0x2d, 0x20, 0x53, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x70, 0x72, 0x65, 0x2d, 0x67,
+    0x7a, 0x69, 0x70, 0x70, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x66, 0x6c, 0x61, 0x73,
+    0x68, 0x2c, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x2f, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x50, 0x61,
+    0x67, 0x65, 0x2e, 0x70, 0x79, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x73, 0x72, 0x63, 0x2f, 0x70,
+    0x61, 0x67, 0x65, 0x2e, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+    0x3e, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x7b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d,
+    0x69, 0x6c, 0x79, 0x3a, 0x20, 0x48, 0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x3b, 0x20,
+    0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d,
+    0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30,
+    0x70, 0x78, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c,
+    0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x7d, 0x0a, 0x2e, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+    0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 0x43, 0x41, 0x46, 0x35,
+    0x30, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b,
+    0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0x20, 0x70,
+    0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x20, 0x34, 0x30, 0x70,
+    0x78, 0x3b, 0x0a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
+    0x69, 0x7a, 0x65, 0x3a, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x3a, 0x20, 0x32, 0x70, 0x78, 0x3b, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20,
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x7d, 0x0a, 0x2e, 0x62, 0x75, 0x74, 0x74, 0x6f,
+    0x6e, 0x32, 0x20, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63,
+    0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3b, 0x7d, 0x0a,
+    0x2e, 0x6b, 0x65, 0x79, 0x20, 0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+    0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x20,
+    0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0x20, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70, 0x78,
+    0x3b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79,
+    0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x20,
+    0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b,
+    0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x32, 0x70, 0x78, 0x3b, 0x20, 0x75, 0x73,
+    0x65, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b,
+    0x20, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x2d, 0x63,
+    0x61, 0x6c, 0x6c, 0x6f, 0x75, 0x74, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x7d, 0x3c, 0x2f,
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62,
+    0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x68, 0x31, 0x3e, 0x53, 0x69, 0x72, 0x72, 0x69, 0x75, 0x73, 0x3c,
+    0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x0a, 0x3c, 0x70, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+    0x20, 0x4d, 0x6f, 0x64, 0x65, 0x3a, 0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f,
+    0x70, 0x3e, 0x0a, 0x3c, 0x70, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x46, 0x61,
+    0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x3a, 0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x22, 0x3e, 0x3c,
+    0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x3c, 0x70, 0x3e, 0x43, 0x75,
+    0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x3c, 0x73, 0x70,
+    0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x22, 0x3e, 0x3c, 0x2f,
+    0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x0a, 0x3c, 0x66, 0x6f, 0x72, 0x6d,
+    0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69,
+    0x74, 0x65, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64,
+    0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d,
+    0x61, 0x6e, 0x64, 0x3d, 0x22, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x22, 0x3e, 0x0a,
+    0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x66, 0x61, 0x76, 0x6f,
+    0x72, 0x69, 0x74, 0x65, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22,
+    0x3e, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x46, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74,
+    0x65, 0x3a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64,
+    0x3d, 0x22, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+    0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x61, 0x76,
+    0x6f, 0x72, 0x69, 0x74, 0x65, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74,
+    0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22,
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x3e,
+    0x0a, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x4e, 0x75, 0x6d,
+    0x62, 0x65, 0x72, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74,
+    0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3d, 0x22,
+    0x64, 0x65, 0x6c, 0x61, 0x79, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66,
+    0x6f, 0x72, 0x3d, 0x22, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49,
+    0x6e, 0x70, 0x75, 0x74, 0x22, 0x3e, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x64, 0x65,
+    0x6c, 0x61, 0x79, 0x28, 0x73, 0x65, 0x63, 0x29, 0x3a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+    0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74,
+    0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x4e, 0x75,
+    0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75,
+    0x74, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x0a, 0x3c, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74,
+    0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22,
+    0x3e, 0x0a, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x0a, 0x3c, 0x70, 0x3e, 0x3c, 0x61,
+    0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x6d, 0x6f, 0x64, 0x65, 0x2f, 0x4a, 0x75, 0x6d,
+    0x70, 0x44, 0x65, 0x6c, 0x61, 0x79, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x63, 0x6f, 0x6d,
+    0x6d, 0x61, 0x6e, 0x64, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x64, 0x65, 0x6c, 0x61, 0x79,
+    0x22, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x64, 0x65,
+    0x6c, 0x61, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x20,
+    0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x61, 0x76,
+    0x6f, 0x72, 0x69, 0x74, 0x65, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f,
+    0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a,
+    0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x6d, 0x6f, 0x64,
+    0x65, 0x2f, 0x4a, 0x75, 0x6d, 0x70, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x22, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65,
+    0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x22, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e,
+    0x6a, 0x75, 0x6d, 0x70, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x20, 0x74, 0x6f, 0x20, 0x66,
+    0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x22, 0x3e, 0x3c,
+    0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c,
+    0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72,
+    0x65, 0x66, 0x3d, 0x22, 0x2f, 0x6d, 0x6f, 0x64, 0x65, 0x2f, 0x4d, 0x6f, 0x64, 0x65, 0x6f, 0x66,
+    0x66, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3d,
+    0x22, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x22, 0x3e, 0x4d, 0x4f, 0x44, 0x45, 0x20, 0x4f, 0x46, 0x46, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x0a, 0x3c, 0x66, 0x6f,
+    0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x43,
+    0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22,
+    0x67, 0x65, 0x74, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+    0x64, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61,
+    0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x43, 0x68, 0x61, 0x6e,
+    0x6e, 0x65, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x3e, 0x47, 0x6f, 0x54, 0x6f, 0x20, 0x43,
+    0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78,
+    0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65,
+    0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+    0x74, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x72,
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x3e, 0x0a, 0x3c, 0x2f,
+    0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x46, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6d, 0x65,
+    0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d,
+    0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3d, 0x22, 0x66, 0x61, 0x76, 0x65, 0x22, 0x3e, 0x0a,
+    0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x46,
+    0x61, 0x76, 0x65, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x3e, 0x47, 0x6f, 0x54, 0x6f, 0x20, 0x46,
+    0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x3a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+    0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65,
+    0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x46, 0x61, 0x76, 0x65, 0x49,
+    0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x46,
+    0x61, 0x76, 0x65, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
+    0x65, 0x64, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d,
+    0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22,
+    0x53, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e,
+    0x0a, 0x0a, 0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x6d,
+    0x6f, 0x64, 0x65, 0x2f, 0x50, 0x77, 0x72, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x63, 0x6f,
+    0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x22, 0x3e, 0x3c, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x50, 0x4f, 0x57, 0x45, 0x52, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x0a, 0x3c, 0x64, 0x65,
+    0x74, 0x61, 0x69, 0x6c, 0x73, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65,
+    0x22, 0x3e, 0x3c, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x3e, 0x41, 0x6c, 0x6c, 0x20, 0x6b,
+    0x65, 0x79, 0x73, 0x3c, 0x2f, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x3e, 0x3c, 0x70, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x6b, 0x65, 0x79, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f,
+    0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x3e, 0x0a, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70,
+    0x74, 0x3e, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x6e,
+    0x65, 0x76, 0x65, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x6f, 0x76, 0x65, 0x72,
+    0x20, 0x61, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6f, 0x6e, 0x20,
+    0x2f, 0x77, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x0a,
+    0x2f, 0x2f, 0x20, 0x63, 0x61, 0x72, 0x72, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6f, 0x74, 0x68, 0x65,
+    0x72, 0x20, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x73, 0x20, 0x73, 0x65, 0x65, 0x20, 0x65, 0x76, 0x65,
+    0x72, 0x79, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20,
+    0x61, 0x77, 0x61, 0x79, 0x2e, 0x20, 0x55, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x0a, 0x2f,
+    0x2f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20,
+    0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x6c, 0x61, 0x69, 0x6e, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x73, 0x2e, 0x20, 0x57, 0x69, 0x74, 0x68,
+    0x6f, 0x75, 0x74, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
+    0x69, 0x6e, 0x6b, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x73,
+    0x74, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x2f,
+    0x2f, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x72, 0x65, 0x64,
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x7b, 0x0a,
+    0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22,
+    0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x22, 0x29, 0x2e, 0x74,
+    0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x2e, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+    0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f,
+    0x66, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d,
+    0x65, 0x28, 0x22, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x22, 0x29, 0x29, 0x20, 0x7b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x65, 0x78,
+    0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x2e, 0x66, 0x61, 0x76, 0x6f, 0x72, 0x69, 0x74, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x7d,
+    0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65,
+    0x73, 0x68, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22,
+    0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x22, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x72, 0x65,
+    0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x73, 0x65, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x28, 0x29, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28,
+    0x73, 0x68, 0x6f, 0x77, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x73, 0x6f,
+    0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x0a, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x29,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x65,
+    0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x22, 0x77, 0x73, 0x3a,
+    0x2f, 0x2f, 0x22, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68,
+    0x6f, 0x73, 0x74, 0x20, 0x2b, 0x20, 0x22, 0x2f, 0x77, 0x73, 0x22, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+    0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x20, 0x3d, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20,
+    0x3d, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d,
+    0x3d, 0x20, 0x22, 0x73, 0x74, 0x61, 0x74, 0x65, 0x22, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x28, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x73,
+    0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x3d, 0x20,
+    0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6f, 0x63, 0x6b,
+    0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+    0x74, 0x2c, 0x20, 0x32, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x7d,
+    0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x75, 0x6e, 0x28, 0x75,
+    0x72, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x26, 0x26, 0x20, 0x73,
+    0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65,
+    0x20, 0x3d, 0x3d, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x4f, 0x50,
+    0x45, 0x4e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+    0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 0x3b, 0x0a,
+    0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66,
+    0x65, 0x74, 0x63, 0x68, 0x28, 0x75, 0x72, 0x6c, 0x2c, 0x20, 0x7b, 0x72, 0x65, 0x64, 0x69, 0x72,
+    0x65, 0x63, 0x74, 0x3a, 0x20, 0x22, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x22, 0x7d, 0x29, 0x2e,
+    0x74, 0x68, 0x65, 0x6e, 0x28, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x29, 0x3b, 0x0a, 0x20,
+    0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x45, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6b,
+    0x65, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65,
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x65,
+    0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x2f, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
+    0x69, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x0a, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x22, 0x29, 0x2e,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+    0x28, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x22, 0x2c, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20,
+    0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6b, 0x65, 0x79, 0x73, 0x22,
+    0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6b, 0x65, 0x79, 0x73, 0x2e, 0x63, 0x68,
+    0x69, 0x6c, 0x64, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x20,
+    0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63,
+    0x68, 0x28, 0x22, 0x2f, 0x6b, 0x65, 0x79, 0x73, 0x22, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28,
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x72, 0x65, 0x73, 0x70,
+    0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x28, 0x29, 0x29, 0x2e, 0x74, 0x68, 0x65,
+    0x6e, 0x28, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x61,
+    0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x6e,
+    0x6b, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x61, 0x22, 0x29, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x6b, 0x65, 0x79, 0x22, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x68, 0x72,
+    0x65, 0x66, 0x20, 0x3d, 0x20, 0x22, 0x2f, 0x6b, 0x65, 0x79, 0x2f, 0x22, 0x20, 0x2b, 0x20, 0x6e,
+    0x61, 0x6d, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x6e,
+    0x6b, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+    0x64, 0x20, 0x3d, 0x20, 0x22, 0x6b, 0x65, 0x79, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x6e, 0x61, 0x6d,
+    0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x2e,
+    0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x61,
+    0x6d, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x73,
+    0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x6c, 0x69, 0x6e, 0x6b, 0x29, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0x0a, 0x20,
+    0x20, 0x7d, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x69,
+    0x6e, 0x67, 0x20, 0x61, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6c, 0x69, 0x73, 0x74, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66,
+    0x72, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x6f, 0x6e,
+    0x6c, 0x79, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x62, 0x75, 0x72, 0x73, 0x74, 0x73,
+    0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x65, 0x74,
+    0x20, 0x67, 0x6f, 0x2c, 0x20, 0x61, 0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68,
+    0x20, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x20, 0x72, 0x61, 0x6d, 0x70, 0x2e, 0x20, 0x4e, 0x65,
+    0x65, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65,
+    0x74, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x74, 0x20, 0x65, 0x76,
+    0x65, 0x72, 0x79, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x68,
+    0x6f, 0x6c, 0x64, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
+    0x0a, 0x6c, 0x65, 0x74, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61,
+    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x22, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x64, 0x6f, 0x77, 0x6e, 0x22, 0x2c, 0x20, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x3d, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x74,
+    0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x73, 0x74, 0x28, 0x22, 0x61,
+    0x2e, 0x6b, 0x65, 0x79, 0x22, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e,
+    0x67, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x26, 0x26, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20,
+    0x26, 0x26, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53,
+    0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65,
+    0x74, 0x2e, 0x4f, 0x50, 0x45, 0x4e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x6f,
+    0x6c, 0x64, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d,
+    0x65, 0x6f, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e,
+    0x73, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x68, 0x6f, 0x6c, 0x64, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x6c,
+    0x69, 0x6e, 0x6b, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20,
+    0x2b, 0x20, 0x22, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x22, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7d, 0x2c, 0x20, 0x33, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x29,
+    0x3b, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61,
+    0x73, 0x65, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x54, 0x69,
+    0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x68, 0x6f, 0x6c, 0x64, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x29,
+    0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20,
+    0x26, 0x26, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x72, 0x65,
+    0x6c, 0x65, 0x61, 0x73, 0x65, 0x22, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+    0x72, 0x75, 0x70, 0x22, 0x2c, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x29, 0x3b, 0x0a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+    0x65, 0x72, 0x63, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x22, 0x2c, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61,
+    0x73, 0x65, 0x29, 0x3b, 0x0a, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61,
+    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x3d,
+    0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x6b,
+    0x20, 0x3d, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e,
+    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x73, 0x74, 0x28, 0x22, 0x61, 0x22, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x6e, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66,
+    0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+    0x21, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x72, 0x75, 0x6e, 0x28, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x67, 0x65, 0x74, 0x41, 0x74,
+    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x68, 0x72, 0x65, 0x66, 0x22, 0x29, 0x2c,
+    0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x63, 0x6f,
+    0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73,
+    0x65, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+    0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x2c, 0x20, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+    0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+    0x20, 0x3d, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3b,
+    0x0a, 0x20, 0x20, 0x72, 0x75, 0x6e, 0x28, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x67, 0x65, 0x74, 0x41,
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x22, 0x29, 0x20, 0x2b, 0x20, 0x22, 0x3f, 0x22, 0x20, 0x2b, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x55,
+    0x52, 0x4c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x28, 0x6e,
+    0x65, 0x77, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x28, 0x66, 0x6f, 0x72, 0x6d,
+    0x29, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x64,
+    0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x2b,
+    0x20, 0x22, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x71, 0x75, 0x65, 0x72,
+    0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x74, 0x5d, 0x22, 0x29, 0x2e, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73,
+    0x68, 0x28, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x29, 0x3b, 0x0a,
+    0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79,
+    0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a};
+
+// 304 for a request with a matching If-None-Match
+const uint8_t pageNotModifiedResponse[122] = {
+    0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x33, 0x30, 0x34, 0x20, 0x4e, 0x6f, 0x74,
+    0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x0d, 0x0a, 0x45, 0x54, 0x61, 0x67, 0x3a,
+    0x20, 0x22, 0x66, 0x62, 0x65, 0x31, 0x62, 0x61, 0x38, 0x37, 0x63, 0x38, 0x33, 0x66, 0x61, 0x64,
+    0x37, 0x30, 0x22, 0x0d, 0x0a, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72,
+    0x6f, 0x6c, 0x3a, 0x20, 0x6e, 0x6f, 0x2d, 0x63, 0x61, 0x63, 0x68, 0x65, 0x0d, 0x0a, 0x56, 0x61,
+    0x72, 0x79, 0x3a, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64,
+    0x69, 0x6e, 0x67, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a,
+    0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x0d, 0x0a, 0x0d, 0x0a};
+
+#endif // PAGE_H
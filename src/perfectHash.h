@@ -0,0 +1,96 @@
+/*
+ *  perfectHash.h
+ *
+ *  Compile-time perfect hash over a fixed list of names, used for the key names in codes.h.
+ *
+ *  The compiler tries seeds of a seeded FNV-1a hash until every name lands in a slot of its own
+ *  in a table of Slots bytes, each slot holding the index of its name. Resolving a name is then
+ *  one hash, one table read and one compare against the only candidate, which rejects names that
+ *  are not in the list. Nothing is searched or allocated at run time.
+ */
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PERFECT_HASH_NO_SEED UINT32_MAX
+#define PERFECT_HASH_MAX_SEEDS 10000 // Tried before giving up, see the static_assert of the user
+
+constexpr uint32_t perfectHashOf(const char *name, size_t length, uint32_t seed)
+{
+  uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+  }
+  return hash ^ (hash >> 15); // FNV-1a's low bits alone spread short names poorly
+}
+
+constexpr size_t perfectHashLength(const char *name)
+{
+  size_t length = 0;
+  while (name[length] != '\0')
+  {
+    length++;
+  }
+  return length;
+}
+
+template <size_t N, size_t Slots>
+struct PerfectHash
+{
+  static_assert(N < 255 && (Slots & (Slots - 1)) == 0, "Up to 254 names, Slots must be a power of two");
+
+  uint32_t seed;
+  uint8_t slots[Slots]; // Index of the name hashed to each slot, N if none is
+  uint8_t lengths[N];
+  const char *const *names;
+
+  // Index of the name in the list, -1 if it is not in it
+  int find(const char *name, size_t length) const
+  {
+    uint8_t index = slots[perfectHashOf(name, length, seed) & (Slots - 1)];
+    if (index == N || lengths[index] != length || memcmp(names[index], name, length) != 0)
+    {
+      return -1;
+    }
+    return index;
+  }
+};
+
+// seed is PERFECT_HASH_NO_SEED if none of the seeds separates all names
+template <size_t Slots, size_t N>
+constexpr PerfectHash<N, Slots> perfectHash(const char *const (&names)[N])
+{
+  PerfectHash<N, Slots> table{};
+  table.names = names;
+  for (size_t i = 0; i < N; i++)
+  {
+    table.lengths[i] = perfectHashLength(names[i]);
+  }
+  for (uint32_t seed = 0; seed < PERFECT_HASH_MAX_SEEDS; seed++)
+  {
+    for (size_t slot = 0; slot < Slots; slot++)
+    {
+      table.slots[slot] = N;
+    }
+    bool separated = true;
+    for (size_t i = 0; i < N && separated; i++)
+    {
+      size_t slot = perfectHashOf(names[i], table.lengths[i], seed) & (Slots - 1);
+      separated = table.slots[slot] == N;
+      table.slots[slot] = i;
+    }
+    if (separated)
+    {
+      table.seed = seed;
+      return table;
+    }
+  }
+  table.seed = PERFECT_HASH_NO_SEED;
+  return table;
+}
+
+#endif // PERFECT_HASH_H
@@ -309,6 +309,17 @@ void noTone(uint8_t aPinNumber){
 #define noTone(a) void()
 #define TONE_PIN           42 // Dummy for examples using it
 
+#elif defined(ARDUINO_ARCH_NATIVE) // Host build with lib/NativeShims, same pins as the ESP32
+#define IR_RECEIVE_PIN      15
+#define IR_SEND_PIN          4
+#define TONE_PIN            27
+#define APPLICATION_PIN     16
+#define ALTERNATIVE_IR_FEEDBACK_LED_PIN 2
+#define _IR_TIMING_TEST_PIN 7
+
+#define tone(...) void()    // no tone() available
+#define noTone(a) void()
+
 #else
 #warning Board / CPU is not detected using pre-processor symbols -> using default values, which may not fit. Please extend PinDefinitionsAndMore.h.
 // Default valued for unidentified boards
@@ -0,0 +1,353 @@
+#include "planner.h"
+
+#include <atomic>
+
+#include "logger.h"
+#include "metrics.h"
+
+static const char *planNames[PLAN_KINDS] = {"direct", "steps", "favorite"};
+
+// Written by the IR task and the setters, read by the server task. Every emitter may face a
+// receiver of its own, the favorites are taken to be the same on all of them.
+static std::atomic<int16_t> currentChannel[IR_MAX_EMITTERS] = {PLANNER_UNKNOWN, PLANNER_UNKNOWN, PLANNER_UNKNOWN,
+                                                                PLANNER_UNKNOWN, PLANNER_UNKNOWN, PLANNER_UNKNOWN,
+                                                                PLANNER_UNKNOWN, PLANNER_UNKNOWN};
+static std::atomic<int16_t> favoriteChannels[10] = {PLANNER_UNKNOWN, PLANNER_UNKNOWN, PLANNER_UNKNOWN, PLANNER_UNKNOWN,
+                                                     PLANNER_UNKNOWN, PLANNER_UNKNOWN, PLANNER_UNKNOWN, PLANNER_UNKNOWN,
+                                                     PLANNER_UNKNOWN, PLANNER_UNKNOWN};
+
+// Server task only
+static Plan lastPlan;
+static bool planned = false;
+static uint32_t plans[PLAN_KINDS];
+static uint64_t savedMicros = 0;
+
+// Mask with a bit for every emitter that is there, IR_ALL_EMITTERS resolved
+static uint8_t emitterMask(uint8_t emitters)
+{
+  uint8_t all = (1 << irEmitterCount()) - 1;
+  return emitters == IR_ALL_EMITTERS ? all : emitters & all;
+}
+
+static void setChannel(uint8_t emitters, int16_t channel)
+{
+  uint8_t mask = emitterMask(emitters);
+  for (int emitter = 0; emitter < IR_MAX_EMITTERS; emitter++)
+  {
+    if (mask & (1 << emitter))
+    {
+      currentChannel[emitter] = channel;
+    }
+  }
+}
+
+// ChannelUp or ChannelDown, off either end of the range the channel is unknown
+static void stepChannel(uint8_t emitters, int step)
+{
+  uint8_t mask = emitterMask(emitters);
+  for (int emitter = 0; emitter < IR_MAX_EMITTERS; emitter++)
+  {
+    int16_t channel = currentChannel[emitter];
+    if ((mask & (1 << emitter)) && channel != PLANNER_UNKNOWN)
+    {
+      currentChannel[emitter] = channel + step < 0 || channel + step > IR_MAX_CHANNEL ? PLANNER_UNKNOWN : channel + step;
+    }
+  }
+}
+
+static void observeKey(Key key, uint8_t emitters)
+{
+  switch (key)
+  {
+  case KEY_CHANNEL_UP:
+    stepChannel(emitters, 1);
+    break;
+  case KEY_CHANNEL_DOWN:
+    stepChannel(emitters, -1);
+    break;
+  // Keys that leave the channel alone
+  case KEY_POWER:
+  case KEY_POWER_ON:
+  case KEY_POWER_OFF:
+  case KEY_DISPLAY:
+  case KEY_VOLUME_UP:
+  case KEY_VOLUME_DOWN:
+  case KEY_MUTE:
+  case KEY_PLAY_PAUSE:
+  case KEY_FAST_FORWARD:
+  case KEY_REWIND:
+  case KEY_REPLAY:
+  case KEY_LOVE:
+  case KEY_FM_TRANSMITTER:
+    break;
+  default:
+    setChannel(emitters, PLANNER_UNKNOWN);
+    break;
+  }
+}
+
+void plannerObserve(const IrCommand &command)
+{
+  switch (command.type)
+  {
+  case IR_COMMAND_KEY:
+    if (command.value < KEY_COUNT)
+    {
+      observeKey((Key)command.value, command.emitters);
+    }
+    break;
+  case IR_COMMAND_HOLD:
+    // A held ChannelUp or ChannelDown auto-repeats on the receiver, how many channels it moved is unknown
+    if (command.value == KEY_CHANNEL_UP || command.value == KEY_CHANNEL_DOWN)
+    {
+      setChannel(command.emitters, PLANNER_UNKNOWN);
+    }
+    else if (command.value < KEY_COUNT)
+    {
+      observeKey((Key)command.value, command.emitters);
+    }
+    break;
+  case IR_COMMAND_CODE:
+    if (command.value < KEY_COUNT)
+    {
+      observeKey((Key)command.value, command.emitters);
+    }
+    else
+    {
+      setChannel(command.emitters, PLANNER_UNKNOWN);
+    }
+    break;
+  case IR_COMMAND_CHANNEL:
+    setChannel(command.emitters, command.value);
+    break;
+  case IR_COMMAND_FAVORITE:
+    setChannel(command.emitters, command.value <= 9 ? favoriteChannels[command.value].load() : PLANNER_UNKNOWN);
+    break;
+  case IR_COMMAND_POWER:
+  case IR_COMMAND_WAIT:
+  case IR_COMMAND_BATCH: // Its steps are observed one by one
+    break;
+  case IR_COMMAND_MACRO:
+    setChannel(command.emitters, PLANNER_UNKNOWN);
+    break;
+  }
+}
+
+void plannerSetChannel(int channel, uint8_t emitters)
+{
+  setChannel(emitters, channel >= 0 && channel <= IR_MAX_CHANNEL ? channel : PLANNER_UNKNOWN);
+}
+
+bool plannerSetFavorite(int favorite, int channel)
+{
+  if (favorite < 0 || favorite > 9 || channel < PLANNER_UNKNOWN || channel > IR_MAX_CHANNEL)
+  {
+    return false;
+  }
+  favoriteChannels[favorite] = channel;
+  return true;
+}
+
+int plannerChannel(uint8_t emitters)
+{
+  uint8_t mask = emitterMask(emitters);
+  int channel = PLANNER_UNKNOWN;
+  for (int emitter = 0; emitter < IR_MAX_EMITTERS; emitter++)
+  {
+    if (mask & (1 << emitter))
+    {
+      if (channel != PLANNER_UNKNOWN && currentChannel[emitter] != channel)
+      {
+        return PLANNER_UNKNOWN;
+      }
+      channel = currentChannel[emitter];
+      if (channel == PLANNER_UNKNOWN)
+      {
+        return PLANNER_UNKNOWN;
+      }
+    }
+  }
+  return channel;
+}
+
+static uint32_t keyMicros(Key key)
+{
+  uint32_t micros = irKeySendMicros(key);
+  return micros != 0 ? micros : PLANNER_DEFAULT_KEY_MICROS;
+}
+
+// Dry run of the channel macro, its target adds up what the IR task would spend
+static uint32_t dryRunMicros;
+
+static void costKey(Key key)
+{
+  dryRunMicros += keyMicros(key);
+}
+
+static void costWait(uint32_t millis)
+{
+  dryRunMicros += millis * 1000;
+}
+
+static uint32_t directMicros(uint16_t channel)
+{
+  Macro macro;
+  const char *error;
+  if (!macroGet(macroFind(MACRO_CHANNEL_NAME), macro) && !macroCompile(MACRO_CHANNEL_DEFAULT, macro, &error))
+  {
+    return UINT32_MAX;
+  }
+  dryRunMicros = 0;
+  macroRun(macro, channel, {costKey, costWait});
+  return dryRunMicros;
+}
+
+uint32_t plannerGoTo(uint16_t channel, Plan &plan, uint8_t emitters)
+{
+  int16_t from = plannerChannel(emitters);
+  plan = {PLAN_DIRECT, from, channel, 0, directMicros(channel), 0};
+  plan.directMicros = plan.estimatedMicros;
+
+  int favorite = -1;
+  for (int i = 0; i < 10; i++)
+  {
+    if (favoriteChannels[i] == channel && keyMicros(numberKeys[i]) < plan.estimatedMicros)
+    {
+      favorite = i;
+      plan = {PLAN_FAVORITE, from, channel, 1, keyMicros(numberKeys[i]), plan.directMicros};
+    }
+  }
+
+  // The model only follows what was sent, steps from it would add to a tune still queued or on the air
+  Key step = from < channel ? KEY_CHANNEL_UP : KEY_CHANNEL_DOWN;
+  int steps = from == PLANNER_UNKNOWN || irTunePending(emitters) ? 0 : abs(channel - from);
+  // Nothing to press if the model says it is there already, but the receiver may have been tuned
+  // by hand since, so that is left to a direct tune
+  if (steps >= 1 && steps <= PLANNER_MAX_STEPS)
+  {
+    uint32_t micros = steps * keyMicros(step) + (steps - 1) * PLANNER_STEP_GAP_MS * 1000;
+    if (micros < plan.estimatedMicros)
+    {
+      plan = {PLAN_STEPS, from, channel, (uint8_t)steps, micros, plan.directMicros};
+    }
+  }
+
+  uint32_t id = 0;
+  switch (plan.kind)
+  {
+  case PLAN_DIRECT:
+    id = irEnqueue(IR_COMMAND_CHANNEL, channel, 0, emitters);
+    break;
+  case PLAN_FAVORITE:
+    id = irEnqueue(IR_COMMAND_FAVORITE, favorite, 0, emitters);
+    break;
+  case PLAN_STEPS:
+  {
+    IrBatch batch;
+    batch.length = 0;
+    batch.tune = true;
+    for (int i = 0; i < steps; i++)
+    {
+      if (i > 0)
+      {
+        batch.steps[batch.length++] = {IR_COMMAND_WAIT, PLANNER_STEP_GAP_MS, 0, 0};
+      }
+      batch.steps[batch.length++] = {IR_COMMAND_KEY, step, 0, 0};
+    }
+    id = irEnqueueBatch(batch, emitters);
+    break;
+  }
+  default:
+    break;
+  }
+  if (id != 0)
+  {
+    logWriteText(LOG_LEVEL_INFO, "Channel plan %s: %u ms instead of %u ms", planNames[plan.kind],
+                 plan.estimatedMicros / 1000, plan.directMicros / 1000);
+    lastPlan = plan;
+    planned = true;
+    plans[plan.kind]++;
+    savedMicros += plan.directMicros - plan.estimatedMicros;
+  }
+  return id;
+}
+
+static void writeChannel(Print &out, int channel)
+{
+  if (channel == PLANNER_UNKNOWN)
+  {
+    out.print("null");
+  }
+  else
+  {
+    out.print(channel);
+  }
+}
+
+void plannerWriteJson(Print &out)
+{
+  out.print("{\"channels\":[");
+  for (int emitter = 0; emitter < irEmitterCount(); emitter++)
+  {
+    if (emitter > 0)
+    {
+      out.print(",");
+    }
+    writeChannel(out, currentChannel[emitter]);
+  }
+  out.print("],\"favorites\":[");
+  for (int i = 0; i < 10; i++)
+  {
+    if (i > 0)
+    {
+      out.print(",");
+    }
+    writeChannel(out, favoriteChannels[i]);
+  }
+  out.print("],\"last\":");
+  if (planned)
+  {
+    out.print("{\"plan\":\"");
+    out.print(planNames[lastPlan.kind]);
+    out.print("\",\"from\":");
+    writeChannel(out, lastPlan.from);
+    out.print(",\"target\":");
+    out.print(lastPlan.target);
+    out.print(",\"presses\":");
+    out.print(lastPlan.presses);
+    out.print(",\"estimatedMs\":");
+    out.print(lastPlan.estimatedMicros / 1000);
+    out.print(",\"directMs\":");
+    out.print(lastPlan.directMicros / 1000);
+    out.print("}");
+  }
+  else
+  {
+    out.print("null");
+  }
+  out.print(",\"plans\":{");
+  for (int kind = 0; kind < PLAN_KINDS; kind++)
+  {
+    out.print(kind == 0 ? "\"" : ",\"");
+    out.print(planNames[kind]);
+    out.print("\":");
+    out.print(plans[kind]);
+  }
+  out.print("},\"savedMs\":");
+  out.print((unsigned long long)(savedMicros / 1000));
+  out.println("}");
+}
+
+void plannerWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_planner_plans_total", "counter", "Channel changes by the plan that was picked.");
+  for (int kind = 0; kind < PLAN_KINDS; kind++)
+  {
+    char labels[24];
+    snprintf(labels, sizeof(labels), "plan=\"%s\"", planNames[kind]);
+    metricsWriteSample(out, "sirius_planner_plans_total", labels, plans[kind]);
+  }
+  metricsWriteFamily(out, "sirius_planner_saved_seconds_total", "counter",
+                     "Estimated time saved against tuning every channel directly.");
+  metricsWriteSeconds(out, "sirius_planner_saved_seconds_total", "", savedMicros);
+}
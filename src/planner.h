@@ -0,0 +1,66 @@
+/*
+ *  planner.h
+ *
+ *  Channel changes by the cheapest key sequence. A model of the receivers keeps the current
+ *  channel in front of each emitter and the channels of the favorites, updated by the IR task from every command it sends
+ *  and set by hand over HTTP where the firmware cannot know them. To reach a channel the planner
+ *  compares, in microseconds until the last key is sent:
+ *
+ *    direct    the "channel" macro, DirectTune and the digits, costed by a dry run of the macro
+ *    steps     ChannelUp or ChannelDown presses PLANNER_STEP_GAP_MS apart, channels taken as
+ *              contiguous, if all emitters sent to are known to be on the same channel, it is
+ *              at most PLANNER_MAX_STEPS away and no tune for them is queued or on the air
+ *    favorite  one digit, if a favorite is known to hold the channel
+ *
+ *  Keys are costed with the send times the IR task measured, or the NEC frame with its repeats
+ *  before a key was ever sent. Anything sent the model cannot follow (other digits, DirectTune on
+ *  its own, presets, Jump, macros, a held ChannelUp or ChannelDown) makes the current channel
+ *  unknown, so a wrong guess costs at most one plan and the next direct tune puts the model right
+ *  again.
+ */
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include <Arduino.h>
+
+#include "irTask.h"
+
+#define PLANNER_UNKNOWN -1
+#define PLANNER_STEP_GAP_MS 400
+#define PLANNER_MAX_STEPS (IR_BATCH_MAX_STEPS / 2) // A press and a gap each
+#define PLANNER_DEFAULT_KEY_MICROS 397500 // NEC frame and 3 repeats, see irTask.cpp
+
+enum PlanKind : uint8_t
+{
+  PLAN_DIRECT,
+  PLAN_STEPS,
+  PLAN_FAVORITE,
+  PLAN_KINDS
+};
+
+struct Plan
+{
+  PlanKind kind;
+  int16_t from;   // Channel before, PLANNER_UNKNOWN if it was not known
+  uint16_t target;
+  uint8_t presses;
+  uint32_t estimatedMicros;
+  uint32_t directMicros; // What tuning directly would have cost
+};
+
+// Model updates, called by the IR task once a command is sent
+void plannerObserve(const IrCommand &command);
+
+// What the receivers of the emitters show now, PLANNER_UNKNOWN to forget it
+void plannerSetChannel(int channel, uint8_t emitters = IR_ALL_EMITTERS);
+bool plannerSetFavorite(int favorite, int channel); // Channel a favorite digit tunes to
+int plannerChannel(uint8_t emitters = IR_ALL_EMITTERS); // PLANNER_UNKNOWN unless all of them are on the same one
+
+// Picks and queues the cheapest plan to reach channel on the emitters. Returns the IR command id,
+// 0 if the queue or the batch slots were full. Called from the HTTP server task only.
+uint32_t plannerGoTo(uint16_t channel, Plan &plan, uint8_t emitters = IR_ALL_EMITTERS);
+
+void plannerWriteJson(Print &out);    // Model, last plan and totals for /planner
+void plannerWriteMetrics(Print &out); // Plans by kind and time saved for /metrics
+
+#endif // PLANNER_H
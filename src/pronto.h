@@ -0,0 +1,150 @@
+/*
+ *  pronto.h
+ *
+ *  Compile-time decoder for the Pronto hex strings in codes.h.
+ *
+ *  Every code of the Sirius remote is a plain NEC frame: 38 kHz carrier, 9 ms / 4.5 ms header,
+ *  32 data bits sent LSB first and the standard NEC repeat burst. Instead of handing the
+ *  ~380 character strings to IrSender.sendPronto() and parsing them on every send, the strings
+ *  are decoded here by the compiler into the packed 32 bit word IrSender.sendNECRaw() expects
+ *  (address in the low byte, inverted address, command, inverted command in the high byte).
+ *
+ *  The strings themselves are only used in constant expressions, so none of them ends up in flash.
+ */
+#ifndef PRONTO_H
+#define PRONTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define NEC_BITS 32
+#define PRONTO_NEC_WORDS 76                               // preamble(4) + header(2) + bits(64) + stop(2) + repeat(4)
+#define PRONTO_NEC_LENGTH (PRONTO_NEC_WORDS * 5 - 1)      // "XXXX" words separated by single spaces
+
+// Pronto words (carrier periods of 26.3 us at 0x006D) of the NEC timing, as found in codes.h
+#define PRONTO_NEC_FREQUENCY 0x006D
+#define PRONTO_NEC_HEADER_MARK 0x0157
+#define PRONTO_NEC_HEADER_SPACE 0x00AC
+#define PRONTO_NEC_BIT_MARK 0x0015
+#define PRONTO_NEC_ZERO_SPACE 0x0016
+#define PRONTO_NEC_ONE_SPACE 0x0041
+#define PRONTO_NEC_TRAILING_SPACE 0x0689
+#define PRONTO_NEC_REPEAT_SPACE 0x0056
+#define PRONTO_NEC_REPEAT_TRAILING_SPACE 0x0E94
+
+constexpr int prontoHexDigit(char c)
+{
+  return (c >= '0' && c <= '9') ? c - '0' : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+}
+
+constexpr size_t prontoLength(const char *pronto)
+{
+  size_t length = 0;
+  while (pronto[length] != '\0')
+  {
+    length++;
+  }
+  return length;
+}
+
+// Returns the aIndex-th 16 bit word of a well formed Pronto string or -1 if it is not hex.
+constexpr int32_t prontoWord(const char *pronto, size_t aIndex)
+{
+  int32_t word = 0;
+  for (size_t i = 0; i < 4; i++)
+  {
+    int digit = prontoHexDigit(pronto[aIndex * 5 + i]);
+    if (digit < 0)
+    {
+      return -1;
+    }
+    word = (word << 4) | digit;
+  }
+  return word;
+}
+
+// Word the Pronto string of aRawData must contain at position aIndex.
+constexpr int32_t necProntoWord(uint32_t aRawData, size_t aIndex)
+{
+  constexpr int32_t head[] = {0x0000, PRONTO_NEC_FREQUENCY, 0x0022, 0x0002, PRONTO_NEC_HEADER_MARK, PRONTO_NEC_HEADER_SPACE};
+  constexpr int32_t tail[] = {PRONTO_NEC_BIT_MARK, PRONTO_NEC_TRAILING_SPACE, PRONTO_NEC_HEADER_MARK, PRONTO_NEC_REPEAT_SPACE,
+                              PRONTO_NEC_BIT_MARK, PRONTO_NEC_REPEAT_TRAILING_SPACE};
+  if (aIndex < 6)
+  {
+    return head[aIndex];
+  }
+  aIndex -= 6;
+  if (aIndex < 2 * NEC_BITS)
+  {
+    if (aIndex % 2 == 0)
+    {
+      return PRONTO_NEC_BIT_MARK;
+    }
+    return (aRawData >> (aIndex / 2)) & 1 ? PRONTO_NEC_ONE_SPACE : PRONTO_NEC_ZERO_SPACE;
+  }
+  return tail[aIndex - 2 * NEC_BITS];
+}
+
+// Packs the 32 data bits of an NEC Pronto string, LSB first, a long space being a one.
+constexpr uint32_t necFromPronto(const char *pronto)
+{
+  uint32_t raw = 0;
+  for (size_t i = 0; i < NEC_BITS; i++)
+  {
+    if (prontoWord(pronto, 6 + 2 * i + 1) == PRONTO_NEC_ONE_SPACE)
+    {
+      raw |= 1UL << i;
+    }
+  }
+  return raw;
+}
+
+// True if re-encoding aRawData gives back exactly the original Pronto string.
+constexpr bool necMatchesPronto(uint32_t aRawData, const char *pronto)
+{
+  if (prontoLength(pronto) != PRONTO_NEC_LENGTH)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < PRONTO_NEC_WORDS; i++)
+  {
+    if (prontoWord(pronto, i) != necProntoWord(aRawData, i) || (i + 1 < PRONTO_NEC_WORDS && pronto[i * 5 + 4] != ' '))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t N>
+struct NecTable
+{
+  uint32_t raw[N];
+  constexpr uint32_t operator[](size_t i) const { return raw[i]; }
+};
+
+template <size_t N>
+constexpr NecTable<N> necTableFromPronto(const char *const (&pronto)[N])
+{
+  NecTable<N> table{};
+  for (size_t i = 0; i < N; i++)
+  {
+    table.raw[i] = necFromPronto(pronto[i]);
+  }
+  return table;
+}
+
+template <size_t N>
+constexpr bool necTableMatchesPronto(const NecTable<N> &table, const char *const (&pronto)[N])
+{
+  for (size_t i = 0; i < N; i++)
+  {
+    if (!necMatchesPronto(table[i], pronto[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif // PRONTO_H
@@ -0,0 +1,165 @@
+/*
+ *  rmtEncoder.h
+ *
+ *  Encodes NEC words into ESP32 RMT items for the RMT transmit backend (IR_BACKEND_RMT).
+ *
+ *  An item holds two (duration, level) halves of up to 32767 ticks, ticks are microseconds
+ *  with the RMT clock divided by 80, level 1 is carrier on. The timings are the ones IRremote
+ *  uses in sendNECRaw(): frame, then each repeat burst 110 ms after the start of the previous
+ *  frame. The whole sequence of a key including its repeats is built by the compiler, so the
+ *  RMT peripheral can send it from flash without any work on the CPU.
+ *
+ *  Nothing here depends on the ESP32, necDurations() turns items back into mark/space
+ *  durations. test/test_rmtEncoder compares them with what IRremote sends, on the host.
+ */
+#ifndef RMT_ENCODER_H
+#define RMT_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pronto.h"
+
+// Microseconds, same as IRremote's ir_NEC.hpp
+#define NEC_UNIT 560
+#define NEC_HEADER_MARK (16 * NEC_UNIT)
+#define NEC_HEADER_SPACE (8 * NEC_UNIT)
+#define NEC_BIT_MARK NEC_UNIT
+#define NEC_ONE_SPACE (3 * NEC_UNIT)
+#define NEC_ZERO_SPACE NEC_UNIT
+#define NEC_REPEAT_HEADER_SPACE (4 * NEC_UNIT)
+#define NEC_REPEAT_PERIOD 110000
+
+#define RMT_MAX_DURATION 32767
+
+// Upper bound of items for a frame plus aRepeats repeat bursts, see rmtNecEncode()
+constexpr size_t rmtNecItems(size_t aRepeats)
+{
+  // Frame: 2 header + 64 bit + 1 stop halves, then at most 3 gap halves. Repeat: 3 halves + 3 gap halves.
+  return (2 + 2 * NEC_BITS + 1 + 3 + aRepeats * 6 + 1) / 2;
+}
+
+constexpr uint32_t rmtItem(uint32_t aDuration0, uint32_t aLevel0, uint32_t aDuration1, uint32_t aLevel1)
+{
+  // Bit layout of rmt_item32_t.val
+  return (aDuration0 & 0x7FFF) | (aLevel0 << 15) | ((aDuration1 & 0x7FFF) << 16) | (aLevel1 << 31);
+}
+
+template <size_t N>
+struct RmtSequence
+{
+  uint32_t items[N];
+  size_t length;
+
+  // Appends a mark (level 1) or space (level 0), split in halves of at most RMT_MAX_DURATION
+  constexpr void push(uint32_t aLevel, uint32_t aDuration, size_t &halves)
+  {
+    while (aDuration > 0)
+    {
+      uint32_t chunk = aDuration > RMT_MAX_DURATION ? RMT_MAX_DURATION : aDuration;
+      size_t item = halves / 2;
+      if (halves % 2 == 0)
+      {
+        items[item] = rmtItem(chunk, aLevel, 0, 0);
+      }
+      else
+      {
+        items[item] |= rmtItem(0, 0, chunk, aLevel);
+      }
+      halves++;
+      aDuration -= chunk;
+    }
+    length = (halves + 1) / 2;
+  }
+};
+
+// Frame of aRawData followed by aRepeats repeat bursts. The last item ends with a zero
+// duration half or is followed by nothing, either way the transmitter stops after it.
+template <size_t Repeats>
+constexpr RmtSequence<rmtNecItems(Repeats)> rmtNecEncode(uint32_t aRawData)
+{
+  RmtSequence<rmtNecItems(Repeats)> sequence{};
+  size_t halves = 0;
+  uint32_t duration = NEC_HEADER_MARK + NEC_HEADER_SPACE + NEC_BIT_MARK;
+  sequence.push(1, NEC_HEADER_MARK, halves);
+  sequence.push(0, NEC_HEADER_SPACE, halves);
+  for (size_t i = 0; i < NEC_BITS; i++)
+  {
+    uint32_t space = (aRawData >> i) & 1 ? NEC_ONE_SPACE : NEC_ZERO_SPACE;
+    sequence.push(1, NEC_BIT_MARK, halves);
+    sequence.push(0, space, halves);
+    duration += NEC_BIT_MARK + space;
+  }
+  sequence.push(1, NEC_BIT_MARK, halves);
+  for (size_t i = 0; i < Repeats; i++)
+  {
+    sequence.push(0, NEC_REPEAT_PERIOD - duration, halves);
+    sequence.push(1, NEC_HEADER_MARK, halves);
+    sequence.push(0, NEC_REPEAT_HEADER_SPACE, halves);
+    sequence.push(1, NEC_BIT_MARK, halves);
+    duration = NEC_HEADER_MARK + NEC_REPEAT_HEADER_SPACE + NEC_BIT_MARK;
+  }
+  return sequence;
+}
+
+// Repeat burst alone, sent NEC_REPEAT_PERIOD after the start of the previous frame or burst while a key is held
+constexpr RmtSequence<2> rmtNecRepeat()
+{
+  RmtSequence<2> sequence{};
+  size_t halves = 0;
+  sequence.push(1, NEC_HEADER_MARK, halves);
+  sequence.push(0, NEC_REPEAT_HEADER_SPACE, halves);
+  sequence.push(1, NEC_BIT_MARK, halves);
+  return sequence;
+}
+
+template <size_t Repeats, size_t N>
+struct RmtNecTable
+{
+  RmtSequence<rmtNecItems(Repeats)> keys[N];
+};
+
+template <size_t Repeats, size_t N>
+constexpr RmtNecTable<Repeats, N> rmtNecTable(const NecTable<N> &codes)
+{
+  RmtNecTable<Repeats, N> table{};
+  for (size_t i = 0; i < N; i++)
+  {
+    table.keys[i] = rmtNecEncode<Repeats>(codes[i]);
+  }
+  return table;
+}
+
+// Expands items into durations, marks positive and spaces negative, joining split halves.
+// Returns the number of durations written.
+inline size_t necDurations(const uint32_t *items, size_t length, int32_t *durations, size_t maxDurations)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    for (int half = 0; half < 2; half++)
+    {
+      uint32_t bits = half == 0 ? items[i] & 0xFFFF : items[i] >> 16;
+      int32_t duration = bits & 0x7FFF;
+      if (duration == 0)
+      {
+        return count;
+      }
+      if ((bits & 0x8000) == 0)
+      {
+        duration = -duration;
+      }
+      if (count > 0 && (durations[count - 1] > 0) == (duration > 0))
+      {
+        durations[count - 1] += duration;
+      }
+      else if (count < maxDurations)
+      {
+        durations[count++] = duration;
+      }
+    }
+  }
+  return count;
+}
+
+#endif // RMT_ENCODER_H
@@ -0,0 +1,270 @@
+#include "scheduler.h"
+
+#include <esp_timer.h>
+
+#include "events.h"
+#include "logger.h"
+#include "metrics.h"
+
+struct HeapEntry
+{
+  int64_t due; // esp_timer_get_time() of the next send
+  uint16_t id;
+  ScheduledJob job;
+};
+
+// Min-heap on due, guarded by heapMutex. The task only holds it to pop and push entries.
+static HeapEntry heap[SCHEDULER_MAX_JOBS];
+static size_t heapSize = 0;
+static uint16_t nextId = 1;
+static uint16_t modeJobId = 0;
+static SemaphoreHandle_t heapMutex = NULL;
+static TaskHandle_t schedulerTaskHandle = NULL;
+static LatencyHistogram lateness; // How long after its due time a job started sending, see irEnqueue()
+
+static void heapSwap(size_t a, size_t b)
+{
+  HeapEntry entry = heap[a];
+  heap[a] = heap[b];
+  heap[b] = entry;
+}
+
+static void siftUp(size_t i)
+{
+  while (i > 0 && heap[i].due < heap[(i - 1) / 2].due)
+  {
+    heapSwap(i, (i - 1) / 2);
+    i = (i - 1) / 2;
+  }
+}
+
+static void siftDown(size_t i)
+{
+  while (1)
+  {
+    size_t smallest = i;
+    size_t left = 2 * i + 1;
+    size_t right = left + 1;
+    if (left < heapSize && heap[left].due < heap[smallest].due)
+    {
+      smallest = left;
+    }
+    if (right < heapSize && heap[right].due < heap[smallest].due)
+    {
+      smallest = right;
+    }
+    if (smallest == i)
+    {
+      return;
+    }
+    heapSwap(i, smallest);
+    i = smallest;
+  }
+}
+
+static void heapPush(const HeapEntry &entry)
+{
+  heap[heapSize] = entry;
+  siftUp(heapSize++);
+}
+
+static void heapRemoveAt(size_t i)
+{
+  heap[i] = heap[--heapSize];
+  if (i < heapSize)
+  {
+    siftDown(i);
+    siftUp(i);
+  }
+}
+
+static int64_t periodMicros(const ScheduledJob &job)
+{
+  uint32_t millisPeriod = job.periodMillis;
+  if (job.jitterMillis > 0)
+  {
+    millisPeriod += random(0, job.jitterMillis);
+  }
+  return (int64_t)millisPeriod * 1000;
+}
+
+// Ticks to sleep until the earliest deadline, rounded up so the task never wakes early
+static TickType_t ticksUntilDue()
+{
+  if (heapSize == 0)
+  {
+    return portMAX_DELAY;
+  }
+  int64_t micros = heap[0].due - esp_timer_get_time();
+  if (micros <= 0)
+  {
+    return 0;
+  }
+  int64_t ticks = (micros + portTICK_PERIOD_MS * 1000 - 1) / (portTICK_PERIOD_MS * 1000);
+  return ticks >= portMAX_DELAY ? portMAX_DELAY - 1 : (TickType_t)ticks;
+}
+
+static void schedulerTask(void *parameter)
+{
+  while (1)
+  {
+    xSemaphoreTake(heapMutex, portMAX_DELAY);
+    TickType_t wait = ticksUntilDue();
+    xSemaphoreGive(heapMutex);
+
+    // Woken early by schedulerAdd()/schedulerRemove() to recompute the deadline
+    if (wait > 0 && ulTaskNotifyTake(pdTRUE, wait) > 0)
+    {
+      continue;
+    }
+
+    IrCommand due[SCHEDULER_MAX_JOBS];
+    int64_t dueMicros[SCHEDULER_MAX_JOBS];
+    size_t dueCount = 0;
+    xSemaphoreTake(heapMutex, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    while (heapSize > 0 && heap[0].due <= now)
+    {
+      HeapEntry entry = heap[0];
+      heapRemoveAt(0);
+      dueMicros[dueCount] = entry.due;
+      due[dueCount++] = {entry.job.command, entry.job.value, 0, entry.id, entry.job.emitters};
+      // Next deadline counts from the intended one so periods do not drift,
+      // unless the job fell behind by more than a period
+      entry.due += periodMicros(entry.job);
+      if (entry.due <= now)
+      {
+        entry.due = now + periodMicros(entry.job);
+      }
+      heapPush(entry);
+    }
+    xSemaphoreGive(heapMutex);
+
+    for (size_t i = 0; i < dueCount; i++)
+    {
+      logWrite(LOG_LEVEL_INFO, "Sending job %u", due[i].id);
+      irEnqueue(due[i].type, due[i].value, 0, due[i].emitters, IR_PRIORITY_SCHEDULED, dueMicros[i]);
+      eventPost(EVENT_JOB_FIRED, due[i].id);
+    }
+  }
+}
+
+void schedulerStart()
+{
+  heapMutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(
+      schedulerTask,        // Function that should be called
+      "Scheduler",          // Name of the task (for debugging)
+      4096,                 // Stack size (bytes)
+      NULL,                 // Parameter to pass
+      1,                    // Task priority
+      &schedulerTaskHandle, // Task handle
+      IR_CORE               // Core, next to the IR task it feeds
+  );
+}
+
+static uint16_t addLocked(const ScheduledJob &job, uint32_t firstDelayMillis)
+{
+  if (heapSize >= SCHEDULER_MAX_JOBS)
+  {
+    return 0;
+  }
+  HeapEntry entry = {esp_timer_get_time() + (int64_t)firstDelayMillis * 1000, nextId, job};
+  nextId = nextId == UINT16_MAX ? 1 : nextId + 1;
+  heapPush(entry);
+  return entry.id;
+}
+
+static bool removeLocked(uint16_t id)
+{
+  for (size_t i = 0; i < heapSize; i++)
+  {
+    if (heap[i].id == id)
+    {
+      heapRemoveAt(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+void schedulerConfigure(const SchedulerConfig &config)
+{
+  xSemaphoreTake(heapMutex, portMAX_DELAY);
+  removeLocked(modeJobId);
+  modeJobId = 0;
+  if (config.mode == MODE_JUMP_DELAY)
+  {
+    modeJobId = addLocked({IR_COMMAND_FAVORITE, config.favorite, config.millisDelay, 0}, 0);
+  }
+  else if (config.mode == MODE_JUMP_RANDOM)
+  {
+    modeJobId = addLocked({IR_COMMAND_FAVORITE, config.favorite, 300000, 60000}, 0);
+  }
+  xSemaphoreGive(heapMutex);
+  xTaskNotifyGive(schedulerTaskHandle);
+}
+
+uint16_t schedulerAdd(const ScheduledJob &job, uint32_t firstDelayMillis)
+{
+  xSemaphoreTake(heapMutex, portMAX_DELAY);
+  uint16_t id = addLocked(job, firstDelayMillis);
+  xSemaphoreGive(heapMutex);
+  xTaskNotifyGive(schedulerTaskHandle);
+  return id;
+}
+
+bool schedulerRemove(uint16_t id)
+{
+  xSemaphoreTake(heapMutex, portMAX_DELAY);
+  bool removed = id != modeJobId && removeLocked(id);
+  xSemaphoreGive(heapMutex);
+  xTaskNotifyGive(schedulerTaskHandle);
+  return removed;
+}
+
+size_t schedulerList(ScheduledJobInfo *jobs, size_t maxJobs)
+{
+  xSemaphoreTake(heapMutex, portMAX_DELAY);
+  int64_t now = esp_timer_get_time();
+  size_t count = 0;
+  for (size_t i = 0; i < heapSize && count < maxJobs; i++)
+  {
+    jobs[count++] = {heap[i].id, heap[i].job, heap[i].due - now};
+  }
+  xSemaphoreGive(heapMutex);
+
+  // Heap order is not due order, a few entries are sorted in place
+  for (size_t i = 1; i < count; i++)
+  {
+    for (size_t j = i; j > 0 && jobs[j].dueInMicros < jobs[j - 1].dueInMicros; j--)
+    {
+      ScheduledJobInfo info = jobs[j];
+      jobs[j] = jobs[j - 1];
+      jobs[j - 1] = info;
+    }
+  }
+  return count;
+}
+
+void schedulerObserveLateness(int64_t micros)
+{
+  lateness.observe(micros < 0 ? 0 : micros > UINT32_MAX ? UINT32_MAX : (uint32_t)micros);
+}
+
+uint32_t schedulerStackHighWaterMark()
+{
+  return uxTaskGetStackHighWaterMark(schedulerTaskHandle);
+}
+
+void schedulerWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_scheduler_jobs", "gauge", "Scheduled jobs including the jump mode.");
+  xSemaphoreTake(heapMutex, portMAX_DELAY);
+  size_t jobs = heapSize;
+  xSemaphoreGive(heapMutex);
+  metricsWriteSample(out, "sirius_scheduler_jobs", "", jobs);
+  metricsWriteFamily(out, "sirius_scheduler_lateness_seconds", "histogram",
+                     "Time between a job's intended fire time and the start of its IR send.");
+  metricsWriteHistogram(out, "sirius_scheduler_lateness_seconds", "", lateness);
+}
@@ -0,0 +1,67 @@
+/*
+ *  scheduler.h
+ *
+ *  Deadline scheduler for repeating IR commands. Jobs live in a fixed size min-heap ordered by
+ *  their next due time (64 bit esp_timer_get_time() microseconds, so no wraparound). One task
+ *  created at boot sleeps until the earliest deadline, or until a job is added or removed, and
+ *  never wakes up while nothing is due. The jump modes are just one more job next to the ones
+ *  users schedule over HTTP.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+#include "irTask.h"
+
+#define SCHEDULER_MAX_JOBS 16
+
+enum JumpMode : uint8_t
+{
+  MODE_OFF,
+  MODE_JUMP_DELAY,
+  MODE_JUMP_RANDOM
+};
+
+struct SchedulerConfig
+{
+  uint8_t mode; // JumpMode
+  uint8_t favorite;
+  uint32_t millisDelay; // Interval of MODE_JUMP_DELAY
+};
+
+struct ScheduledJob
+{
+  IrCommandType command;
+  uint16_t value;
+  uint32_t periodMillis; // Time between two sends
+  uint32_t jitterMillis; // Up to this much random time is added to each period
+  uint8_t emitters;      // Sent on these, IR_ALL_EMITTERS for all of them
+};
+
+struct ScheduledJobInfo
+{
+  uint16_t id;
+  ScheduledJob job;
+  int64_t dueInMicros;
+};
+
+void schedulerStart();
+
+// Replaces the jump mode job. A new mode sends right away, then every period.
+void schedulerConfigure(const SchedulerConfig &config);
+
+// Adds a job first due after firstDelayMillis. Returns its id or 0 if all slots are taken.
+uint16_t schedulerAdd(const ScheduledJob &job, uint32_t firstDelayMillis);
+bool schedulerRemove(uint16_t id);
+
+// Copies up to maxJobs jobs in due order, returns how many were copied.
+size_t schedulerList(ScheduledJobInfo *jobs, size_t maxJobs);
+
+// Called by the IR task when a scheduled command starts sending, micros after it was due
+void schedulerObserveLateness(int64_t micros);
+
+uint32_t schedulerStackHighWaterMark(); // Bytes of stack the scheduler task never used
+void schedulerWriteMetrics(Print &out);  // Job count and lateness histogram for /metrics
+
+#endif // SCHEDULER_H
@@ -0,0 +1,78 @@
+#include "settings.h"
+
+#include <Preferences.h>
+
+#include "logger.h"
+#include "metrics.h"
+#include "scheduler.h"
+
+// What is in NVS, one blob so a save is a single write
+struct StoredSettings
+{
+  uint8_t version;
+  Settings settings;
+};
+
+static Preferences preferences;
+static Settings stored;   // Last written or read
+static Settings pending;
+static bool dirty = false;
+static uint32_t changedMillis = 0;
+static uint32_t changes = 0;
+static uint32_t writes = 0;
+
+static bool same(const Settings &a, const Settings &b)
+{
+  return a.mode == b.mode && a.favorite == b.favorite && a.secondsDelay == b.secondsDelay &&
+         a.millisDelay == b.millisDelay;
+}
+
+bool settingsBegin(Settings &settings)
+{
+  preferences.begin("settings", false);
+  StoredSettings blob;
+  stored = settings;
+  if (preferences.getBytes("s", &blob, sizeof(blob)) != sizeof(blob) || blob.version != SETTINGS_VERSION ||
+      blob.settings.mode > MODE_JUMP_RANDOM || blob.settings.favorite > 9 || blob.settings.millisDelay == 0)
+  {
+    return false;
+  }
+  stored = blob.settings;
+  settings = blob.settings;
+  return true;
+}
+
+void settingsChanged(const Settings &settings)
+{
+  pending = settings;
+  dirty = true;
+  changedMillis = millis();
+  changes++;
+}
+
+bool settingsPoll()
+{
+  if (!dirty || millis() - changedMillis < SETTINGS_WRITE_DELAY_MS)
+  {
+    return false;
+  }
+  dirty = false;
+  if (same(pending, stored))
+  {
+    return false;
+  }
+  StoredSettings blob = {SETTINGS_VERSION, pending};
+  preferences.putBytes("s", &blob, sizeof(blob));
+  stored = pending;
+  writes++;
+  logWrite(LOG_LEVEL_INFO, "Settings saved");
+  return true;
+}
+
+void settingsWriteMetrics(Print &out)
+{
+  metricsWriteFamily(out, "sirius_settings_changes_total", "counter", "Changes of the mode, favorite or delay.");
+  metricsWriteSample(out, "sirius_settings_changes_total", "", changes);
+  metricsWriteFamily(out, "sirius_settings_writes_total", "counter", "Settings written to flash.");
+  metricsWriteSample(out, "sirius_settings_writes_total", "", writes);
+}
@@ -0,0 +1,36 @@
+/*
+ *  settings.h
+ *
+ *  The jump mode, its favorite and its delay, kept in NVS so the unit comes back in the mode it
+ *  was left in after a power cut. Changes only mark the settings dirty, settingsPoll() writes them
+ *  once they have not changed for SETTINGS_WRITE_DELAY_MS and differ from what is stored, so a
+ *  burst of form submits costs one flash write, or none if it ends where it started.
+ *
+ *  settingsChanged() and settingsPoll() are called from the HTTP server task only.
+ */
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <Arduino.h>
+
+#define SETTINGS_VERSION 1
+#define SETTINGS_WRITE_DELAY_MS 5000
+
+struct Settings
+{
+  uint8_t mode; // JumpMode
+  uint8_t favorite;
+  uint32_t secondsDelay;
+  uint32_t millisDelay; // Interval of MODE_JUMP_DELAY
+};
+
+// Reads the stored settings. Returns false and leaves settings as they are if there are none or
+// they are not valid.
+bool settingsBegin(Settings &settings);
+
+void settingsChanged(const Settings &settings); // Writes them after SETTINGS_WRITE_DELAY_MS without changes
+bool settingsPoll(); // Writes pending settings once they are due, true if it did
+
+void settingsWriteMetrics(Print &out); // Changes and actual flash writes for /metrics
+
+#endif // SETTINGS_H
@@ -0,0 +1,93 @@
+#include "sha1.h"
+
+#include <string.h>
+
+static uint32_t rotateLeft(uint32_t value, int bits)
+{
+  return value << bits | value >> (32 - bits);
+}
+
+static void processBlock(uint32_t state[5], const uint8_t block[64])
+{
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++)
+  {
+    w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 | (uint32_t)block[4 * i + 2] << 8 |
+           block[4 * i + 3];
+  }
+  for (int i = 16; i < 80; i++)
+  {
+    w[i] = rotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+  for (int i = 0; i < 80; i++)
+  {
+    uint32_t f, k;
+    if (i < 20)
+    {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    }
+    else if (i < 40)
+    {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    }
+    else if (i < 60)
+    {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    }
+    else
+    {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    uint32_t temp = rotateLeft(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rotateLeft(b, 30);
+    b = a;
+    a = temp;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+void sha1(const uint8_t *data, size_t length, uint8_t digest[SHA1_DIGEST_BYTES])
+{
+  uint32_t state[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  size_t offset = 0;
+  for (; offset + 64 <= length; offset += 64)
+  {
+    processBlock(state, data + offset);
+  }
+
+  // Last block: the rest, a 1 bit, zeros and the length in bits, spilling into a second block if needed
+  uint8_t block[128] = {};
+  size_t rest = length - offset;
+  memcpy(block, data + offset, rest);
+  block[rest] = 0x80;
+  size_t blocks = rest + 9 <= 64 ? 1 : 2;
+  uint64_t bits = (uint64_t)length * 8;
+  for (int i = 0; i < 8; i++)
+  {
+    block[blocks * 64 - 1 - i] = bits >> (8 * i);
+  }
+  for (size_t i = 0; i < blocks; i++)
+  {
+    processBlock(state, block + 64 * i);
+  }
+
+  for (int i = 0; i < 5; i++)
+  {
+    digest[4 * i] = state[i] >> 24;
+    digest[4 * i + 1] = state[i] >> 16;
+    digest[4 * i + 2] = state[i] >> 8;
+    digest[4 * i + 3] = state[i];
+  }
+}
@@ -0,0 +1,17 @@
+/*
+ *  sha1.h
+ *
+ *  SHA-1, only for the WebSocket handshake (RFC 6455 hashes the client's key with it). Small and
+ *  portable so the same code runs on the ESP32 and in the native build.
+ */
+#ifndef SHA1_H
+#define SHA1_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA1_DIGEST_BYTES 20
+
+void sha1(const uint8_t *data, size_t length, uint8_t digest[SHA1_DIGEST_BYTES]);
+
+#endif // SHA1_H
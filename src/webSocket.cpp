@@ -0,0 +1,278 @@
+#include "webSocket.h"
+
+#include "sha1.h"
+
+enum WebSocketOpcode : uint8_t
+{
+  WS_CONTINUATION = 0x0,
+  WS_TEXT = 0x1,
+  WS_BINARY = 0x2,
+  WS_CLOSE = 0x8,
+  WS_PING = 0x9,
+  WS_PONG = 0xA
+};
+
+// Status codes of a close frame
+#define WS_CLOSE_NORMAL 1000
+#define WS_CLOSE_PROTOCOL_ERROR 1002
+#define WS_CLOSE_UNSUPPORTED 1003
+#define WS_CLOSE_TOO_BIG 1009
+
+#define WS_MAX_HEADER 8 // 2 bytes, 2 bytes of extended length, 4 bytes of mask
+
+struct WebSocketClient
+{
+  WiFiClient client;
+  bool open; // Slot in use, client may still have been closed by the peer
+  uint8_t frame[WS_MAX_HEADER + WS_MAX_FRAME];
+  size_t length; // Bytes of the frame being received
+};
+
+static WebSocketClient clients[WS_MAX_CLIENTS];
+
+static const char base64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// text needs 4 * ((length + 2) / 3) + 1 chars
+static void base64Encode(const uint8_t *data, size_t length, char *text)
+{
+  for (size_t i = 0; i < length; i += 3)
+  {
+    uint32_t bits = (uint32_t)data[i] << 16;
+    if (i + 1 < length)
+    {
+      bits |= data[i + 1] << 8;
+    }
+    if (i + 2 < length)
+    {
+      bits |= data[i + 2];
+    }
+    *text++ = base64Digits[bits >> 18 & 0x3F];
+    *text++ = base64Digits[bits >> 12 & 0x3F];
+    *text++ = i + 1 < length ? base64Digits[bits >> 6 & 0x3F] : '=';
+    *text++ = i + 2 < length ? base64Digits[bits & 0x3F] : '=';
+  }
+  *text = '\0';
+}
+
+// Frame header and payload go out in one write so a message is one TCP segment
+static bool sendFrame(WiFiClient &client, WebSocketOpcode opcode, const uint8_t *payload, size_t length)
+{
+  uint8_t frame[4 + WS_MAX_MESSAGE];
+  size_t header = 2;
+  frame[0] = 0x80 | opcode; // Final fragment, server frames are not masked
+  if (length < 126)
+  {
+    frame[1] = length;
+  }
+  else
+  {
+    frame[1] = 126;
+    frame[2] = length >> 8;
+    frame[3] = length;
+    header = 4;
+  }
+  memcpy(frame + header, payload, length);
+  return client.write(frame, header + length) == header + length;
+}
+
+static void drop(WebSocketClient &slot)
+{
+  slot.client.stop();
+  slot.open = false;
+  slot.length = 0;
+}
+
+static void closeWith(WebSocketClient &slot, uint16_t code)
+{
+  uint8_t payload[2] = {(uint8_t)(code >> 8), (uint8_t)code};
+  sendFrame(slot.client, WS_CLOSE, payload, sizeof(payload));
+  drop(slot);
+}
+
+int webSocketAccept(WiFiClient &client, const char *key)
+{
+  for (int i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    if (clients[i].open)
+    {
+      continue;
+    }
+
+    static const char guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    char keyGuid[WS_KEY_LENGTH + sizeof(guid)];
+    snprintf(keyGuid, sizeof(keyGuid), "%s%s", key, guid);
+    uint8_t digest[SHA1_DIGEST_BYTES];
+    sha1((const uint8_t *)keyGuid, strlen(keyGuid), digest);
+    char accept[4 * ((SHA1_DIGEST_BYTES + 2) / 3) + 1];
+    base64Encode(digest, sizeof(digest), accept);
+
+    char response[160];
+    int length = snprintf(response, sizeof(response),
+                          "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                          "Sec-WebSocket-Accept: %s\r\n\r\n",
+                          accept);
+    client.write((const uint8_t *)response, length);
+    client.setNoDelay(true);
+    clients[i].client = client;
+    clients[i].open = true;
+    clients[i].length = 0;
+    return i;
+  }
+  client.print("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+  return -1;
+}
+
+// Handles the first complete frame in the buffer. Returns its size, 0 if it is not complete
+// yet or the client was dropped.
+static size_t handleFrame(int index, WebSocketTextHandler onText)
+{
+  WebSocketClient &slot = clients[index];
+  if (slot.length < 2)
+  {
+    return 0;
+  }
+  bool final = slot.frame[0] & 0x80;
+  uint8_t opcode = slot.frame[0] & 0x0F;
+  bool masked = slot.frame[1] & 0x80;
+  size_t length = slot.frame[1] & 0x7F;
+  size_t header = 2;
+  if (!masked)
+  {
+    closeWith(slot, WS_CLOSE_PROTOCOL_ERROR);
+    return 0;
+  }
+  if (length == 126)
+  {
+    if (slot.length < 4)
+    {
+      return 0;
+    }
+    length = slot.frame[2] << 8 | slot.frame[3];
+    header = 4;
+  }
+  else if (length == 127)
+  {
+    length = SIZE_MAX;
+  }
+  if (length > WS_MAX_FRAME)
+  {
+    closeWith(slot, WS_CLOSE_TOO_BIG);
+    return 0;
+  }
+  // Commands are a few bytes, browsers never split those
+  if (!final || opcode == WS_CONTINUATION || opcode == WS_BINARY)
+  {
+    closeWith(slot, WS_CLOSE_UNSUPPORTED);
+    return 0;
+  }
+  const uint8_t *mask = slot.frame + header;
+  header += 4;
+  if (slot.length < header + length)
+  {
+    return 0;
+  }
+
+  char payload[WS_MAX_FRAME + 1];
+  for (size_t i = 0; i < length; i++)
+  {
+    payload[i] = slot.frame[header + i] ^ mask[i % 4];
+  }
+  payload[length] = '\0';
+
+  switch (opcode)
+  {
+  case WS_TEXT:
+    onText(index, payload, length);
+    if (!slot.client.connected()) // The reply failed and dropped it
+    {
+      return 0;
+    }
+    break;
+  case WS_PING:
+    sendFrame(slot.client, WS_PONG, (const uint8_t *)payload, length);
+    break;
+  case WS_CLOSE:
+    closeWith(slot, WS_CLOSE_NORMAL);
+    return 0;
+  case WS_PONG:
+    break;
+  default:
+    closeWith(slot, WS_CLOSE_PROTOCOL_ERROR);
+    return 0;
+  }
+  return header + length;
+}
+
+bool webSocketPoll(WebSocketTextHandler onText)
+{
+  bool worked = false;
+  for (int i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    WebSocketClient &slot = clients[i];
+    if (!slot.open)
+    {
+      continue;
+    }
+    if (!slot.client.connected())
+    {
+      drop(slot);
+      worked = true;
+      continue;
+    }
+    if (slot.client.available() <= 0)
+    {
+      continue;
+    }
+    int length = slot.client.read(slot.frame + slot.length, sizeof(slot.frame) - slot.length);
+    if (length <= 0)
+    {
+      continue;
+    }
+    slot.length += length;
+    worked = true;
+
+    size_t used;
+    while ((used = handleFrame(i, onText)) > 0)
+    {
+      slot.length -= used;
+      memmove(slot.frame, slot.frame + used, slot.length);
+    }
+  }
+  return worked;
+}
+
+bool webSocketSend(int client, const char *text, size_t length)
+{
+  WebSocketClient &slot = clients[client];
+  if (length > WS_MAX_MESSAGE || !slot.open)
+  {
+    return false;
+  }
+  if (!sendFrame(slot.client, WS_TEXT, (const uint8_t *)text, length))
+  {
+    drop(slot);
+    return false;
+  }
+  return true;
+}
+
+void webSocketBroadcast(const char *text, size_t length)
+{
+  for (int i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    webSocketSend(i, text, length);
+  }
+}
+
+size_t webSocketClientCount()
+{
+  size_t count = 0;
+  for (int i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    if (clients[i].open)
+    {
+      count++;
+    }
+  }
+  return count;
+}
@@ -0,0 +1,37 @@
+/*
+ *  webSocket.h
+ *
+ *  Minimal RFC 6455 server side for the control page: a few clients stay connected after the
+ *  handshake on /ws, the device pushes state changes to them and they send commands as short
+ *  text frames, each costing one frame instead of a TCP handshake and a page load.
+ *
+ *  Only what the page needs: unfragmented text frames of up to WS_MAX_FRAME bytes from the
+ *  client, ping, pong and close. Anything else closes the connection. Everything runs in the
+ *  server task next to the HTTP connections, no allocation.
+ */
+#ifndef WEB_SOCKET_H
+#define WEB_SOCKET_H
+
+#include <WiFi.h>
+
+#define WS_MAX_CLIENTS 4
+#define WS_MAX_FRAME 128    // Payload of a frame from a client, larger ones close the connection
+#define WS_MAX_MESSAGE 256  // Payload of a frame to the clients
+#define WS_KEY_LENGTH 24    // Sec-WebSocket-Key, base64 of 16 bytes
+
+// Called for every text frame, text is terminated. client is the index for webSocketSend().
+typedef void (*WebSocketTextHandler)(int client, const char *text, size_t length);
+
+// Answers the upgrade request with 101 and keeps a copy of the client. Returns its index, or -1
+// after answering 503 when all slots are taken.
+int webSocketAccept(WiFiClient &client, const char *key);
+
+// Reads what the clients sent, answers pings and closes, drops clients that went away. Never
+// blocks, false if there was nothing to do.
+bool webSocketPoll(WebSocketTextHandler onText);
+
+bool webSocketSend(int client, const char *text, size_t length);
+void webSocketBroadcast(const char *text, size_t length);
+size_t webSocketClientCount();
+
+#endif // WEB_SOCKET_H
@@ -0,0 +1,83 @@
+// Host test of the RMT encoder: the items of rmtNecEncode() and rmtNecRepeat() must expand to
+// the same marks and spaces the IRremote shim records for sendNECRaw() and sendNECRepeat().
+// Run with "pio test -e native".
+#include <IRremote.hpp>
+#include <unity.h>
+
+#include "../../src/rmtEncoder.h"
+
+#define TEST_MAX_DURATIONS 256
+
+static const uint32_t testCodes[] = {0x00000000, 0xFFFFFFFF, 0x12345678, 0xE31CFF00};
+
+static size_t recordedDurations(int32_t *durations)
+{
+  size_t count = irRecordedDurations(durations, TEST_MAX_DURATIONS);
+  irRecorderClear();
+  return count;
+}
+
+static void assertSameDurations(const uint32_t *items, size_t length)
+{
+  int32_t encoded[TEST_MAX_DURATIONS];
+  int32_t recorded[TEST_MAX_DURATIONS];
+  size_t encodedCount = necDurations(items, length, encoded, TEST_MAX_DURATIONS);
+  size_t recordedCount = recordedDurations(recorded);
+  TEST_ASSERT_EQUAL_UINT32(recordedCount, encodedCount);
+  TEST_ASSERT_EQUAL_INT32_ARRAY(recorded, encoded, recordedCount);
+}
+
+template <size_t Repeats>
+static void testEncodeRepeats()
+{
+  for (uint32_t code : testCodes)
+  {
+    auto sequence = rmtNecEncode<Repeats>(code);
+    irRecorderClear();
+    IrSender.sendNECRaw(code, Repeats);
+    assertSameDurations(sequence.items, sequence.length);
+  }
+}
+
+static void testEncodeNoRepeat()
+{
+  testEncodeRepeats<0>();
+}
+
+static void testEncodeOneRepeat()
+{
+  testEncodeRepeats<1>();
+}
+
+static void testEncodeThreeRepeats()
+{
+  // The gaps before the second and third burst are longer than an RMT half and get split
+  testEncodeRepeats<3>();
+}
+
+static void testRepeatBurst()
+{
+  auto sequence = rmtNecRepeat();
+  irRecorderClear();
+  IrSender.sendNECRepeat();
+  assertSameDurations(sequence.items, sequence.length);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main()
+{
+  setenv("NATIVE_IR_REALTIME", "0", 1);
+  UNITY_BEGIN();
+  RUN_TEST(testEncodeNoRepeat);
+  RUN_TEST(testEncodeOneRepeat);
+  RUN_TEST(testEncodeThreeRepeats);
+  RUN_TEST(testRepeatBurst);
+  return UNITY_END();
+}
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""Builds the binary code database (see src/codeDb.h) the firmware maps from its "codedb" flash
+partition, so codes can be swapped without building a new firmware.
+
+    python3 tools/codeDb.py IR/Sirius.hex --names "IR/Sirius function list.txt" -o .pio/codedb.bin
+    python3 tools/codeDb.py IR/Sirius.CCF --names "IR/Sirius function list.txt" -o .pio/codedb.bin
+    python3 tools/codeDb.py --dump .pio/codedb.bin
+
+Inputs:
+  *.hex   Pronto export, "Device Code: <d> Function: <n>" lines each followed by its code
+  *.ccf   Pronto CCF file, the codes stored in it are taken in file order as functions 0, 1, ...
+  other   one Pronto code per line
+
+Record n holds function n, which is Key n of the firmware (codes.h follows the same function
+list). --names takes "<n>,<name>" lines, names lose parentheses, spaces and punctuation like the
+ones in codes.h ("Volume Up" -> "VolumeUp"). Functions without a name are called F<n>.
+
+Flash the result to the partition with
+    esptool.py write_flash 0x3E0000 .pio/codedb.bin
+The native build maps the file named by NATIVE_CODEDB, .pio/codedb.bin by default.
+"""
+import argparse
+import re
+import struct
+import sys
+
+MAGIC = b"IRDB"
+VERSION = 1
+HEADER = struct.Struct("<4sHHHHIII16s8s")  # CodeDbHeader
+ENTRY = struct.Struct("<16sBBHI")  # CodeDbEntry
+PROTOCOL_NEC = 1
+MAX_NAME = 15
+EMPTY_SLOT = 0xFF
+
+# Pronto words of the NEC timing in carrier periods at 0x006D (38 kHz), same as src/pronto.h
+NEC_FREQUENCY = 0x006D
+NEC_HEADER_MARK = 0x0157
+NEC_HEADER_SPACE = 0x00AC
+NEC_BIT_MARK = 0x0015
+NEC_ONE_SPACE = 0x0041
+
+
+def fnv1a(data, seed=0):
+    value = (2166136261 ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def perfectHashOf(name, seed):
+    # perfectHashOf() in src/perfectHash.h
+    value = fnv1a(name, seed)
+    return value ^ (value >> 15)
+
+
+def near(value, expected):
+    return abs(value - expected) <= expected // 4 + 2
+
+
+def necFromPronto(words):
+    """Packed word for sendNECRaw(), None if the code is not a plain NEC frame."""
+    if len(words) < 4 + 2 * 34 or words[0] != 0 or words[1] != NEC_FREQUENCY:
+        return None
+    burst = words[4 : 4 + 2 * words[2]]
+    if len(burst) < 2 * 34 or not near(burst[0], NEC_HEADER_MARK) or not near(burst[1], NEC_HEADER_SPACE):
+        return None
+    value = 0
+    for bit in range(32):
+        mark, space = burst[2 + 2 * bit], burst[3 + 2 * bit]
+        if not near(mark, NEC_BIT_MARK):
+            return None
+        if near(space, NEC_ONE_SPACE):
+            value |= 1 << bit
+        elif not near(space, NEC_BIT_MARK):
+            return None
+    # Extended NEC addresses are fine, sendNECRaw() sends the word as it is, but the command must check
+    if (value >> 16) & 0xFF != ~(value >> 24) & 0xFF:
+        return None
+    return value
+
+
+def words(text):
+    return [int(word, 16) for word in text.split()]
+
+
+def readHex(path):
+    codes = {}
+    function = None
+    for line in open(path, encoding="latin-1"):
+        match = re.match(r"\s*Device Code:\s*\d+\s+Function:\s*(\d+)", line)
+        if match:
+            function = int(match.group(1))
+        elif line.strip() and function is not None:
+            codes[function] = words(line)
+            function = None
+    return codes
+
+
+def readCcf(path):
+    data = open(path, "rb").read()
+    codes = {}
+    offset = 0
+    # Learned and Pronto codes are stored as big endian words starting 0000 <frequency> <once> <repeat>
+    pattern = re.compile(rb"\x00\x00\x00[\x01-\xff][\x00-\x01][\x00-\xff]\x00[\x00-\xff]", re.S)
+    while True:
+        match = pattern.search(data, offset)
+        if match is None:
+            break
+        start = match.start()
+        header = struct.unpack(">4H", data[start : start + 8])
+        length = 4 + 2 * (header[2] + header[3])
+        code = list(struct.unpack(f">{length}H", data[start : start + 2 * length])) if start + 2 * length <= len(
+            data) else None
+        if code and header[2] + header[3] > 0 and necFromPronto(code) is not None:
+            codes[len(codes)] = code
+            offset = start + 2 * length
+        else:
+            offset = start + 1
+    return codes
+
+
+def readPronto(path):
+    lines = [line for line in open(path) if line.strip() and not line.startswith("#")]
+    return {index: words(line) for index, line in enumerate(lines)}
+
+
+def readNames(path):
+    names = {}
+    for line in open(path, encoding="utf-8"):
+        if "," in line:
+            index, name = line.split(",", 1)
+            name = re.sub(r"\(.*?\)", "", name)
+            names[int(index)] = re.sub(r"[^A-Za-z0-9]", "", name)[:MAX_NAME]
+    return names
+
+
+def perfectHash(names):
+    slots = 1
+    while slots < 4 * len(names):
+        slots *= 2
+    for seed in range(1000000):
+        table = [EMPTY_SLOT] * slots
+        for index, name in enumerate(names):
+            slot = perfectHashOf(name, seed) & (slots - 1)
+            if table[slot] != EMPTY_SLOT:
+                break
+            table[slot] = index
+        else:
+            return seed, table
+    sys.exit("codeDb: no perfect hash for these names")
+
+
+def build(codes, names, profile):
+    count = max(codes) + 1
+    entries = []
+    for function in range(count):
+        name = names.get(function) or f"F{function}"
+        if function not in codes:
+            sys.exit(f"codeDb: function {function} has no code")
+        value = necFromPronto(codes[function])
+        if value is None:
+            sys.exit(f"codeDb: function {function} ({name}) is not a plain NEC code")
+        entries.append((name.encode(), value))
+    seed, table = perfectHash([name for name, _ in entries])
+    body = b"".join(ENTRY.pack(name, PROTOCOL_NEC, len(name), 0, value) for name, value in entries) + bytes(table)
+    header = HEADER.pack(MAGIC, VERSION, HEADER.size, count, len(table), seed, HEADER.size + len(body), fnv1a(body),
+                         profile.encode()[:15], b"")
+    return header + body
+
+
+def dump(path):
+    data = open(path, "rb").read()
+    magic, version, headerSize, count, slots, seed, total, checksum, profile, _ = HEADER.unpack_from(data)
+    profile = profile.rstrip(b"\0").decode()
+    valid = "ok" if fnv1a(data[headerSize:total]) == checksum else "BAD"
+    print(f"{path}: {magic.decode()} v{version}, profile {profile}, {count} codes, {total} bytes, "
+          f"hash seed {seed} over {slots} slots, checksum {valid}")
+    for index in range(count):
+        name, protocol, length, _, value = ENTRY.unpack_from(data, headerSize + index * ENTRY.size)
+        print(f"{index:3} {name[:length].decode():16} NEC 0x{value:08X}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("input", nargs="?", help="Pronto .hex export, .ccf file or Pronto text")
+    parser.add_argument("--names", help="function list, <n>,<name> per line")
+    parser.add_argument("--profile", default="", help="profile name stored in the header, the input's name by default")
+    parser.add_argument("-o", "--output", default=".pio/codedb.bin")
+    parser.add_argument("--dump", metavar="BIN", help="print a code database instead of building one")
+    args = parser.parse_args()
+    if args.dump:
+        dump(args.dump)
+        return
+    if not args.input:
+        parser.error("input missing")
+    extension = args.input.lower().rsplit(".", 1)[-1]
+    codes = readHex(args.input) if extension == "hex" else readCcf(args.input) if extension == "ccf" else readPronto(
+        args.input)
+    if not codes:
+        sys.exit(f"codeDb: no codes in {args.input}")
+    names = readNames(args.names) if args.names else {}
+    profile = args.profile or re.sub(r"\..*$", "", args.input.replace("\\", "/").rsplit("/", 1)[-1])
+    data = build(codes, names, profile)
+    with open(args.output, "wb") as output:
+        output.write(data)
+    print(f"codeDb: wrote {args.output}, {len(codes)} codes, {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Turns web/index.html into src/page.h: complete HTTP responses, headers included, that the
+firmware sends from flash with a single write.
+
+    python3 tools/embedPage.py
+
+Also runs as a PlatformIO pre-build script (extra_scripts in platformio.ini) and only rewrites
+src/page.h when the page changed. The gzip stream has no timestamp, so the same page always
+gives the same bytes and the same strong ETag.
+"""
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__))) if "__file__" in globals() else os.getcwd()
+PAGE = os.path.join(ROOT, "web", "index.html")
+HEADER = os.path.join(ROOT, "src", "page.h")
+
+
+def response(status, headers, body=b""):
+    lines = [f"HTTP/1.1 {status}"] + [f"{name}: {value}" for name, value in headers] + ["Connection: close", "", ""]
+    return "\r\n".join(lines).encode() + body
+
+
+def array(name, data, comment):
+    rows = [", ".join(f"0x{byte:02x}" for byte in data[i : i + 16]) for i in range(0, len(data), 16)]
+    body = ",\n    ".join(rows)
+    return f"// {comment}\nconst uint8_t {name}[{len(data)}] = {{\n    {body}}};\n"
+
+
+def render(html):
+    compressed = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = '"' + hashlib.sha256(html).hexdigest()[:16] + '"'
+    cache = [("ETag", etag), ("Cache-Control", "no-cache"), ("Vary", "Accept-Encoding")]
+    text = [("Content-Type", "text/html; charset=utf-8")]
+    gzipped = response("200 OK", text + [("Content-Encoding", "gzip"), ("Content-Length", len(compressed))] + cache,
+                       compressed)
+    plain = response("200 OK", text + [("Content-Length", len(html))] + cache, html)
+    notModified = response("304 Not Modified", cache)
+    return (
+        "/*\n"
+        " *  page.h\n"
+        " *\n"
+        " *  Generated by tools/embedPage.py from web/index.html, edit the page and rebuild instead.\n"
+        f" *  {len(html)} bytes of HTML, {len(compressed)} gzipped.\n"
+        " */\n"
+        "#ifndef PAGE_H\n"
+        "#define PAGE_H\n\n"
+        "#include <stdint.h>\n\n"
+        f"#define PAGE_ETAG \"{etag.replace(chr(34), chr(92) + chr(34))}\"\n\n"
+        + array("pageGzipResponse", gzipped, "200 with the gzipped page, for clients sending Accept-Encoding: gzip")
+        + "\n"
+        + array("pagePlainResponse", plain, "200 with the page as is")
+        + "\n"
+        + array("pageNotModifiedResponse", notModified, "304 for a request with a matching If-None-Match")
+        + "\n#endif // PAGE_H\n"
+    )
+
+
+def embed(*args, **kwargs):
+    with open(PAGE, "rb") as page:
+        text = render(page.read())
+    if os.path.exists(HEADER):
+        with open(HEADER) as header:
+            if header.read() == text:
+                return
+    with open(HEADER, "w") as header:
+        header.write(text)
+    print("embedPage: wrote " + os.path.relpath(HEADER, ROOT))
+
+
+try:
+    Import("env")  # noqa: F821, defined when PlatformIO runs this file
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+    PAGE = os.path.join(ROOT, "web", "index.html")
+    HEADER = os.path.join(ROOT, "src", "page.h")
+    embed()
+except NameError:
+    if __name__ == "__main__":
+        embed()
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""Load test of the control server: concurrent clients replaying the page's routes, with optional
+slowloris clients that hold connections open, and a report of throughput, latency percentiles
+and errors. Meant for the host build, it works the same against the board.
+
+    pio run -e native -t exec &
+    python3 tools/loadTest.py --clients 8 --duration 20
+    python3 tools/loadTest.py --clients 8 --slowloris 6 --duration 20
+    python3 tools/loadTest.py --port 18080 --clients 4 --mix /setChannel=1,/mode/Modeoff=1 --json
+
+Every client sends one request per connection like the page does and waits for the server to
+close it. Latency runs from connect() until the whole response is read, so time spent waiting
+for a free connection slot (see src/httpServer.h) is part of it. Errors are counted by kind:
+refused or reset connections, timeouts, and statuses other than 2xx/3xx (503 when all slots are
+busy, 408 when a request took too long).
+
+A slowloris client sends a request line and then one header line every --slow-interval seconds
+without ever finishing the request. It keeps its slot until the server times it out, then
+reconnects. With a server that serves one client at a time every other request queues behind it;
+with too few slots the fast clients see 503s. Both show up in the numbers.
+
+The server's own counters (accepted connections, timeouts, busy rejections) are read from
+/metrics before and after the run and reported as the difference.
+"""
+import argparse
+import asyncio
+import json
+import random
+import re
+import sys
+import time
+
+# Routes of the page with weights, {n} is replaced by a random valid value
+DEFAULT_MIX = [
+    ("/mode/Modeoff", 2),
+    ("/mode/JumpDelay", 1),
+    ("/mode/JumpRandom", 1),
+    ("/setChannel?setChannelInput={channel}", 3),
+    ("/setFave?setFaveInput={fave}", 3),
+    ("/delayNumber?delayNumberInput={seconds}", 1),
+    ("/favoriteNumber?favoriteNumberInput={fave}", 1),
+]
+
+SERVER_COUNTERS = [
+    "sirius_http_connections_accepted_total",
+    "sirius_http_request_timeouts_total",
+    "sirius_http_rejected_busy_total",
+]
+
+
+def parse_mix(text):
+    mix = []
+    for item in text.split(","):
+        route, _, weight = item.partition("=")
+        mix.append((route, int(weight) if weight else 1))
+    return mix
+
+
+def fill(route):
+    return route.format(channel=random.randint(1, 999), fave=random.randint(0, 9), seconds=random.randint(5, 60))
+
+
+def percentile(values, p):
+    # Nearest rank on sorted values
+    if not values:
+        return 0.0
+    rank = max(0, min(len(values) - 1, int(round(p / 100 * len(values) + 0.5)) - 1))
+    return values[rank]
+
+
+class Stats:
+    def __init__(self):
+        self.latencies = {}  # Route without query -> seconds of the successful requests
+        self.errors = {}  # Kind -> count
+        self.statuses = {}
+        self.slow_connections = 0
+        self.slow_closed_by_server = 0
+        self.slow_held = []  # Seconds each slowloris connection was kept open
+
+    def error(self, kind):
+        self.errors[kind] = self.errors.get(kind, 0) + 1
+
+
+async def request(host, port, path, timeout):
+    """Sends one GET, returns (status, seconds). Raises on connection errors and timeouts."""
+    start = time.perf_counter()
+    reader, writer = await asyncio.wait_for(asyncio.open_connection(host, port), timeout)
+    try:
+        writer.write(f"GET {path} HTTP/1.1\r\nHost: {host}\r\nConnection: close\r\n\r\n".encode())
+        await writer.drain()
+        response = await asyncio.wait_for(reader.read(), timeout - (time.perf_counter() - start))
+    finally:
+        writer.close()
+    seconds = time.perf_counter() - start
+    match = re.match(rb"HTTP/1\.[01] (\d{3})", response)
+    if not match:
+        raise ConnectionError("no status line")
+    return int(match.group(1)), seconds
+
+
+async def client(args, mix, stats, deadline):
+    routes = [route for route, _ in mix]
+    weights = [weight for _, weight in mix]
+    while time.monotonic() < deadline:
+        path = fill(random.choices(routes, weights)[0])
+        name = path.split("?")[0]
+        try:
+            status, seconds = await request(args.host, args.port, path, args.timeout)
+        except asyncio.TimeoutError:
+            stats.error("timeout")
+            continue
+        except ConnectionRefusedError:
+            stats.error("refused")
+            await asyncio.sleep(0.05)
+            continue
+        except (ConnectionError, OSError) as exception:
+            stats.error(type(exception).__name__)
+            continue
+        stats.statuses[status] = stats.statuses.get(status, 0) + 1
+        if status >= 400:
+            stats.error(f"http {status}")
+        else:
+            stats.latencies.setdefault(name, []).append(seconds)
+        if args.think > 0:
+            await asyncio.sleep(args.think)
+
+
+async def slowloris(args, stats, deadline):
+    while time.monotonic() < deadline:
+        try:
+            reader, writer = await asyncio.open_connection(args.host, args.port)
+        except OSError:
+            await asyncio.sleep(0.1)
+            continue
+        stats.slow_connections += 1
+        opened = time.monotonic()
+        closed_by_server = False
+        try:
+            writer.write(f"GET / HTTP/1.1\r\nHost: {args.host}\r\n".encode())
+            line = 0
+            while time.monotonic() < deadline:
+                await writer.drain()
+                # Anything readable, a 408 or the close, means the server gave up on us
+                try:
+                    data = await asyncio.wait_for(reader.read(256), args.slow_interval)
+                    closed_by_server = True
+                    if not data:
+                        break
+                    await reader.read()
+                    break
+                except asyncio.TimeoutError:
+                    pass
+                writer.write(f"X-Slow-{line}: {line}\r\n".encode())
+                line += 1
+        except (ConnectionError, OSError):
+            closed_by_server = True
+        finally:
+            writer.close()
+        stats.slow_held.append(time.monotonic() - opened)
+        if closed_by_server:
+            stats.slow_closed_by_server += 1
+
+
+async def server_counters(args):
+    """Counters of SERVER_COUNTERS from /metrics, empty if it cannot be read."""
+    try:
+        reader, writer = await asyncio.wait_for(asyncio.open_connection(args.host, args.port), args.timeout)
+        writer.write(f"GET /metrics HTTP/1.1\r\nHost: {args.host}\r\n\r\n".encode())
+        await writer.drain()
+        text = (await asyncio.wait_for(reader.read(), args.timeout)).decode(errors="replace")
+        writer.close()
+    except (OSError, asyncio.TimeoutError):
+        return {}
+    counters = {}
+    for name in SERVER_COUNTERS:
+        match = re.search(rf"^{name} (\S+)$", text, re.MULTILINE)
+        if match:
+            counters[name] = float(match.group(1))
+    return counters
+
+
+async def run(args, mix):
+    stats = Stats()
+    before = await server_counters(args)
+    start = time.monotonic()
+    deadline = start + args.duration
+    # Slowloris clients first so they hold their slots before the fast ones arrive
+    slow = [asyncio.create_task(slowloris(args, stats, deadline)) for _ in range(args.slowloris)]
+    if slow:
+        await asyncio.sleep(0.2)
+    await asyncio.gather(*[client(args, mix, stats, deadline) for _ in range(args.clients)])
+    elapsed = time.monotonic() - start
+    for task in slow:
+        task.cancel()
+    await asyncio.gather(*slow, return_exceptions=True)
+    after = await server_counters(args)
+    server = {name: after[name] - before.get(name, 0) for name in after}
+    return stats, elapsed, server
+
+
+def summary(values):
+    values = sorted(values)
+    return {
+        "count": len(values),
+        "p50_ms": percentile(values, 50) * 1000,
+        "p95_ms": percentile(values, 95) * 1000,
+        "p99_ms": percentile(values, 99) * 1000,
+        "max_ms": (values[-1] if values else 0) * 1000,
+    }
+
+
+def report(args, stats, elapsed, server):
+    everything = [seconds for values in stats.latencies.values() for seconds in values]
+    result = {
+        "clients": args.clients,
+        "slowloris": args.slowloris,
+        "seconds": round(elapsed, 3),
+        "requests_per_second": round(len(everything) / elapsed, 1) if elapsed > 0 else 0,
+        "latency": summary(everything),
+        "routes": {route: summary(values) for route, values in sorted(stats.latencies.items())},
+        "errors": stats.errors,
+        "statuses": {str(status): count for status, count in sorted(stats.statuses.items())},
+        "slowloris_connections": stats.slow_connections,
+        "slowloris_closed_by_server": stats.slow_closed_by_server,
+        "slowloris_held_p50_ms": percentile(sorted(stats.slow_held), 50) * 1000,
+        "server": server,
+    }
+    if args.json:
+        print(json.dumps(result))
+        return result
+
+    latency = result["latency"]
+    print(f"{args.clients} clients, {args.slowloris} slowloris, {elapsed:.1f} s")
+    print(f"{latency['count']} ok, {sum(stats.errors.values())} errors, {result['requests_per_second']} req/s")
+    print()
+    print(f"{'route':36} {'count':>7} {'p50 ms':>9} {'p95 ms':>9} {'p99 ms':>9} {'max ms':>9}")
+    for route, row in list(result["routes"].items()) + [("all", latency)]:
+        print(f"{route:36} {row['count']:7} {row['p50_ms']:9.2f} {row['p95_ms']:9.2f} {row['p99_ms']:9.2f} "
+              f"{row['max_ms']:9.2f}")
+    if stats.errors:
+        print()
+        for kind, count in sorted(stats.errors.items()):
+            print(f"error {kind:30} {count:7}")
+    if args.slowloris:
+        print()
+        print(f"slowloris: {stats.slow_connections} connections, {stats.slow_closed_by_server} closed by the "
+              f"server, held {result['slowloris_held_p50_ms']:.0f} ms (p50)")
+    if server:
+        print()
+        for name, value in server.items():
+            print(f"{name:44} {value:+.0f}")
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=8080, help="8080 for the native build, 80 on the board")
+    parser.add_argument("--clients", type=int, default=4, help="concurrent clients sending requests")
+    parser.add_argument("--slowloris", type=int, default=0, help="clients that never finish their request")
+    parser.add_argument("--slow-interval", type=float, default=1.0, help="seconds between their header lines")
+    parser.add_argument("--duration", type=float, default=10.0, help="seconds to run")
+    parser.add_argument("--timeout", type=float, default=10.0, help="seconds until a request counts as timed out")
+    parser.add_argument("--think", type=float, default=0.0, help="seconds a client waits between requests")
+    parser.add_argument("--mix", type=parse_mix, help="route=weight,... instead of the page's routes")
+    parser.add_argument("--seed", type=int, help="for the same sequence of routes and values")
+    parser.add_argument("--json", action="store_true", help="one JSON line instead of the table")
+    parser.add_argument("--max-error-rate", type=float, help="exit with 1 if more errors than this fraction")
+    args = parser.parse_args()
+    if args.seed is not None:
+        random.seed(args.seed)
+
+    stats, elapsed, server = asyncio.run(run(args, args.mix or DEFAULT_MIX))
+    result = report(args, stats, elapsed, server)
+    total = result["latency"]["count"] + sum(stats.errors.values())
+    if args.max_error_rate is not None and total > 0 and sum(stats.errors.values()) / total > args.max_error_rate:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()